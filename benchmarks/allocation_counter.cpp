@@ -0,0 +1,60 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "allocation_counter.hpp"
+
+
+namespace {
+
+    std::atomic<std::uint64_t> allocationCount(0);
+
+    void* allocate(std::size_t size) {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        if (void* pointer = std::malloc(size ? size : 1)) return pointer;
+        throw std::bad_alloc();
+    }
+
+}
+
+void* operator new(std::size_t size) {
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return allocate(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+
+namespace rubiks {
+
+    std::uint64_t nbAllocations() {
+        return allocationCount.load(std::memory_order_relaxed);
+    }
+
+    AllocationCounter::AllocationCounter(benchmark::State& state)
+            : state_(state),
+              firstAllocation_(nbAllocations()) {}
+
+    AllocationCounter::~AllocationCounter() {
+        state_.counters["allocs/op"] = benchmark::Counter((double) (nbAllocations() - firstAllocation_),
+                                                          benchmark::Counter::kAvgIterations);
+    }
+
+}
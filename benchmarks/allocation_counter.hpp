@@ -0,0 +1,34 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+
+namespace rubiks {
+
+    /**
+     * @brief Returns the number of heap allocations made by the process so far.
+     * @details The benchmarks executable replaces the global operator new to count them.
+     * @return number of calls to operator new
+     */
+    std::uint64_t nbAllocations();
+
+    /**
+     * @class AllocationCounter
+     * @brief Reports the average number of heap allocations per iteration of a benchmark
+     * @details Build it right before the benchmark loop; its destructor adds the "allocs/op" counter to the results.
+     */
+    class AllocationCounter {
+    public:
+        explicit AllocationCounter(benchmark::State& state);
+        ~AllocationCounter();
+
+        AllocationCounter(const AllocationCounter&) = delete;
+        AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+    private:
+        benchmark::State& state_;
+        std::uint64_t firstAllocation_;
+    };
+
+}
@@ -0,0 +1,247 @@
+#include <benchmark/benchmark.h>
+#include <ostream>
+#include <streambuf>
+#include <vector>
+
+#include "allocation_counter.hpp"
+#include "coordinates.hpp"
+#include "cube.hpp"
+#include "cube_arena.hpp"
+#include "cube_batch.hpp"
+#include "face_turn_kernels.hpp"
+#include "goals.hpp"
+#include "nxn_cube_state.hpp"
+#include "symmetries.hpp"
+#include "transposition_table.hpp"
+#include "zobrist.hpp"
+
+using namespace rubiks;
+
+
+namespace {
+
+    /**
+     * @brief Stream buffer discarding its input, so that printing benchmarks only measure the formatting
+     */
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override { return c; }
+        std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+    };
+
+    void rotateFaceArguments(benchmark::internal::Benchmark* benchmark) {
+        for (int face = 0; face < CubeState_::NB_FACES; ++face) {
+            for (int rotation = 0; rotation < 3; ++rotation) {
+                benchmark->Args({face, rotation});
+            }
+        }
+    }
+
+}
+
+static void BM_CubeState_rotateFace(benchmark::State& state) {
+    const auto color = (Color) state.range(0);
+    const auto rotation = (Rotation) state.range(1);
+    CubeState_ cubeState;
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        cubeState.rotateFace(color, rotation);
+        benchmark::DoNotOptimize(cubeState);
+    }
+}
+BENCHMARK(BM_CubeState_rotateFace)->Apply(rotateFaceArguments);
+
+static void BM_CubeState_rotateFaces(benchmark::State& state) {
+    std::vector<CubeState_> states((std::size_t) state.range(0));
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        CubeState_::rotateFaces(states.data(), states.size(), Color::RED, Rotation::CLOCKWISE);
+        benchmark::DoNotOptimize(states.data());
+    }
+    state.SetItemsProcessed((std::int64_t) state.iterations() * state.range(0));
+    state.SetLabel(FaceTurnKernel_::getImplementation());
+}
+BENCHMARK(BM_CubeState_rotateFaces)->Arg(8)->Arg(32)->Arg(1024);
+
+static void BM_CubeBatch_applySequence(benchmark::State& state) {
+    CubeBatch batch((std::size_t) state.range(0));
+    const std::vector<Move> moves = parseMoves("R U R' U' R' F R2 U' R' U' R U R' F'", Color::RED, Color::BLUE);
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        batch.applySequence(moves);
+        benchmark::DoNotOptimize(batch);
+    }
+    state.SetItemsProcessed((std::int64_t) state.iterations() * state.range(0) * (std::int64_t) moves.size());
+}
+BENCHMARK(BM_CubeBatch_applySequence)->Arg(1024)->Arg(1 << 16);
+
+template <unsigned short N>
+static void BM_NxNCubeState_rotateLayer(benchmark::State& state) {
+    CubeState<N> cube;
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        // Slice turn from the RED face, the outer layer for the 2x2 cube
+        cube.rotateLayer(Color::RED, N / 2, Rotation::CLOCKWISE);
+        benchmark::DoNotOptimize(cube);
+    }
+}
+BENCHMARK_TEMPLATE(BM_NxNCubeState_rotateLayer, 2);
+BENCHMARK_TEMPLATE(BM_NxNCubeState_rotateLayer, 3);
+BENCHMARK_TEMPLATE(BM_NxNCubeState_rotateLayer, 4);
+BENCHMARK_TEMPLATE(BM_NxNCubeState_rotateLayer, 5);
+
+static void BM_Cube_shuffle(benchmark::State& state) {
+    Cube cube;
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        cube.shuffle((unsigned int) state.range(0));
+        benchmark::DoNotOptimize(cube);
+    }
+}
+BENCHMARK(BM_Cube_shuffle)->Arg(1)->Arg(20)->Arg(100);
+
+static void BM_Cube_getFace(benchmark::State& state) {
+    const auto facePose = (FacePose) state.range(0);
+    Cube cube(20);
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(cube.getFace(facePose));
+    }
+}
+BENCHMARK(BM_Cube_getFace)->DenseRange(0, 5);
+
+static void BM_Cube_getAllFacelets(benchmark::State& state) {
+    Cube cube(20);
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(cube.getAllFacelets());
+    }
+}
+BENCHMARK(BM_Cube_getAllFacelets);
+
+static void BM_Cube_isSorted(benchmark::State& state) {
+    Cube cube((unsigned int) state.range(0));
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(cube.isSorted());
+    }
+}
+BENCHMARK(BM_Cube_isSorted)->Arg(0)->Arg(20);
+
+static void BM_StateGoal_matches(benchmark::State& state) {
+    const StateGoal goal = getF2LGoal(Color::GREEN);
+    Cube cube((unsigned int) state.range(0));
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(goal.matches(cube.getState()));
+    }
+}
+BENCHMARK(BM_StateGoal_matches)->Arg(0)->Arg(20);
+
+static void BM_Cube_print(benchmark::State& state) {
+    Cube cube(20);
+    NullBuffer buffer;
+    std::ostream os(&buffer);
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        os << cube;
+    }
+}
+BENCHMARK(BM_Cube_print);
+
+static void BM_Cube_construction(benchmark::State& state) {
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        Cube cube;
+        benchmark::DoNotOptimize(cube);
+    }
+}
+BENCHMARK(BM_Cube_construction);
+
+static void BM_Cube_constructionWithColors(benchmark::State& state) {
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        Cube cube(Color::BLUE, Color::WHITE);
+        benchmark::DoNotOptimize(cube);
+    }
+}
+BENCHMARK(BM_Cube_constructionWithColors);
+
+static void BM_CubeArena_acquire(benchmark::State& state) {
+    CubeArena arena((std::size_t) state.range(0));
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        // A used cube is reset when it is handed out again
+        for (std::int64_t i = 0; i < state.range(0); ++i) {
+            arena.acquire()->rotate(Color::RED, Rotation::CLOCKWISE);
+        }
+        arena.releaseAll();
+    }
+    state.SetItemsProcessed((std::int64_t) state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CubeArena_acquire)->Arg(1024);
+
+static void BM_HashedCubeState_rotateFace(benchmark::State& state) {
+    HashedCubeState hashedState;
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        hashedState.rotateFace(Color::RED, Rotation::CLOCKWISE);
+        benchmark::DoNotOptimize(hashedState.getHash());
+    }
+}
+BENCHMARK(BM_HashedCubeState_rotateFace);
+
+static void BM_getZobristHash(benchmark::State& state) {
+    const Cube cube(20);
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(getZobristHash(cube.getState()));
+    }
+}
+BENCHMARK(BM_getZobristHash);
+
+static void BM_TranspositionTable_probe(benchmark::State& state) {
+    TranspositionTable table((std::size_t) state.range(0) << 20);
+    std::uint64_t hash = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < 1 << 16; ++i) {
+        hash = hash * 6364136223846793005ULL + 1442695040888963407ULL;
+        table.store(hash, TranspositionEntry());
+    }
+    TranspositionEntry entry;
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        hash = hash * 6364136223846793005ULL + 1442695040888963407ULL;
+        benchmark::DoNotOptimize(table.probe(hash, entry));
+    }
+}
+BENCHMARK(BM_TranspositionTable_probe)->Arg(1)->Arg(64);
+
+static void BM_getCanonicalState(benchmark::State& state) {
+    const Cube cube(20);
+    const bool withInversion = state.range(0) != 0;
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(getCanonicalState(cube.getState(), withInversion));
+    }
+}
+BENCHMARK(BM_getCanonicalState)->Arg(0)->Arg(1);
+
+static void BM_rankState(benchmark::State& state) {
+    const Cube cube(20);
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(rankState(cube.getState()));
+    }
+}
+BENCHMARK(BM_rankState);
+
+static void BM_unrankState(benchmark::State& state) {
+    const StateRank rank = rankState(Cube(20).getState());
+    AllocationCounter allocations(state);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(unrankState(rank));
+    }
+}
+BENCHMARK(BM_unrankState);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,29 @@
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include "enumeration.hpp"
+
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <depth> [threads] [--symmetries]" << std::endl;
+        return 1;
+    }
+    const auto depth = (unsigned short) std::atoi(argv[1]);
+    const auto nbThreads = (unsigned int) (argc > 2 ? std::atoi(argv[2]) : 0);
+    const bool useSymmetries = argc > 3 && !std::strcmp(argv[3], "--symmetries");
+
+    rubiks::WorkStealingPool pool(nbThreads);
+    const auto start = std::chrono::steady_clock::now();
+    const rubiks::EnumerationResult result = rubiks::enumerateDistances(depth, pool, useSymmetries);
+    const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+    for (std::size_t distance = 0; distance < result.nbStates.size(); ++distance) {
+        std::cout << distance << "\t" << result.nbStates[distance] << std::endl;
+    }
+    std::cout << result.nbClasses << " stored states, " << result.nbMoves << " moves in " << duration.count()
+              << " s (" << result.nbMoves / duration.count() << " moves/s) on " << pool.nbThreads() << " threads"
+              << std::endl;
+    return 0;
+}
@@ -3,7 +3,10 @@
 
 
 int main(int argc, char* argv[]) {
-    rubiks::Cube cube(20);
+    rubiks::Cube cube;
+    rubiks::StreamMoveObserver moveTracer(std::cout);
+    cube.setMoveObserver(&moveTracer);
+    cube.shuffle(20);
     std::cout << cube << std::endl;
     return 0;
-}
\ No newline at end of file
+}
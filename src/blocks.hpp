@@ -1,11 +1,11 @@
 #pragma once
 
-#include <algorithm>
+#include <array>
 #include <map>
-#include <string>
 #include <utility>
 
 #include "colors.hpp"
+#include "cubies.hpp"
 
 
 namespace rubiks {
@@ -61,33 +61,44 @@ namespace rubiks {
          * @brief Maps the given cube face color to the given block face color
          * @param color block face color
          * @param faceColor cube face color
-         * @param doHash whether to re-compute the hash value of the block after this operation (defaults to true)
          */
-        void setColorPlace(const Color& color, const Color& faceColor, bool doHash=true);
+        void setColorPlace(const Color& color, const Color& faceColor);
 
         /**
-         * @brief Maps the given cube faces color to the given block faces colors, then recomputes the block' hash value
+         * @brief Maps the given cube faces color to the given block faces colors
          * @param color block faces colors
          * @param faceColor cube faces colors
          */
         void setColorsPlaces(std::array<Color, nbFaces>&& blockFacesColors, std::array<Color, nbFaces>&& cubeFacesColors);
 
         const std::map<Color, Color>& blockColors() const;
-        const HashColorArray& hashValue() const;
+
+        /**
+         * @brief returns the bitmask of the block colors
+         * @return hash value of the block colors (see hashColors())
+         */
+        HashColorArray hashValue() const;
+
+        /**
+         * @brief returns the identifier of the block, computed once from its colors
+         * @return index of the corner (0-7) or edge (0-11), NO_CUBIE if the colors do not form a block
+         */
+        unsigned char id() const;
 
     private:
         /**
-         * @brief Computes the internal hash value of the block
+         * @brief Computes the bitmask and the identifier of the block from its colors
          */
         void hash();
 
         std::map<Color, Color> blockColors_;
-        HashColorArray hashValue_;
+        HashColorArray hashValue_ = 0;
+        unsigned char id_ = NO_CUBIE;
     };
 
     template<std::size_t nbFaces>
     Block<nbFaces>::Block(std::array<Color, nbFaces> &&colors) {
-        initColorPlaces(colors);
+        initColorsPlaces(std::move(colors));
     }
 
     template<std::size_t nbFaces>
@@ -112,36 +123,37 @@ namespace rubiks {
     }
 
     template<std::size_t nbFaces>
-    void Block<nbFaces>::setColorPlace(const Color &color, const Color &faceColor, bool doHash) {
+    void Block<nbFaces>::setColorPlace(const Color &color, const Color &faceColor) {
         blockColors_.at(color) = faceColor;
-        if (doHash) hash();
     }
 
     template<std::size_t nbFaces>
     void Block<nbFaces>::setColorsPlaces(std::array<Color, nbFaces>&& blockFacesColors,
                                          std::array<Color, nbFaces>&& cubeFacesColors) {
         for (std::size_t i=0; i<nbFaces; ++i) {
-            setColorPlace(blockFacesColors[i], cubeFacesColors[i], false);
+            setColorPlace(blockFacesColors[i], cubeFacesColors[i]);
         }
-        hash();
     }
 
     template<std::size_t nbFaces>
     void Block<nbFaces>::hash() {
-        hashValue_ = "";
-
+        hashValue_ = 0;
         for (const auto& blockColor : blockColors_) {
-            hashValue_ += hashColor(blockColor.first);
+            hashValue_ |= getColorMask(blockColor.first);
         }
-
-        std::sort(hashValue_.begin(), hashValue_.end());
+        id_ = nbFaces == 3 ? getCornerId(hashValue_) : getEdgeId(hashValue_);
     }
 
     template<std::size_t nbFaces>
-    const HashColorArray& Block<nbFaces>::hashValue() const {
+    HashColorArray Block<nbFaces>::hashValue() const {
         return hashValue_;
     }
 
+    template<std::size_t nbFaces>
+    unsigned char Block<nbFaces>::id() const {
+        return id_;
+    }
+
     template<std::size_t nbFaces>
     const std::map<Color, Color>& Block<nbFaces>::blockColors() const {
         return blockColors_;
@@ -1,17 +1,89 @@
 #pragma once
 
-#include <utility>
-#include <map>
-
 #include "colors.hpp"
 #include "positions.hpp"
 
 
 namespace rubiks {
 
+    /**
+     * @brief Relations between the face colors of a cube, indexed by Color (Color::UNDEFINED included)
+     */
+    struct ColorRelations_ {
+        Color opposites[NB_COLORS + 1];                            /*!< color of the opposite face */
+        Color rightFromFrontAndTop[NB_COLORS + 1][NB_COLORS + 1];  /*!< color on the right of a front and top */
+        Color defaultTops[NB_COLORS + 1];                          /*!< default top color of a front color */
+    };
+
+    /**
+     * @brief Computes the relations between face colors, at compile time
+     * @return relations between face colors
+     */
+    constexpr ColorRelations_ buildColorRelations() {
+        ColorRelations_ relations{};
+        for (unsigned short i = 0; i <= NB_COLORS; ++i) {
+            relations.opposites[i] = Color::UNDEFINED;
+            relations.defaultTops[i] = Color::UNDEFINED;
+            for (unsigned short j = 0; j <= NB_COLORS; ++j) {
+                relations.rightFromFrontAndTop[i][j] = Color::UNDEFINED;
+            }
+        }
+
+        relations.opposites[(unsigned short) Color::RED] = Color::ORANGE;
+        relations.opposites[(unsigned short) Color::ORANGE] = Color::RED;
+        relations.opposites[(unsigned short) Color::BLUE] = Color::GREEN;
+        relations.opposites[(unsigned short) Color::GREEN] = Color::BLUE;
+        relations.opposites[(unsigned short) Color::YELLOW] = Color::WHITE;
+        relations.opposites[(unsigned short) Color::WHITE] = Color::YELLOW;
+
+        relations.defaultTops[(unsigned short) Color::WHITE] = Color::BLUE;
+        relations.defaultTops[(unsigned short) Color::YELLOW] = Color::RED;
+        relations.defaultTops[(unsigned short) Color::BLUE] = Color::RED;
+        relations.defaultTops[(unsigned short) Color::GREEN] = Color::RED;
+        relations.defaultTops[(unsigned short) Color::RED] = Color::WHITE;
+        relations.defaultTops[(unsigned short) Color::ORANGE] = Color::GREEN;
+
+        // Given a front and top color, it remains only a binary constraint: which color is right and which is left
+        Color front = Color::RED;
+        Color top = Color::BLUE;
+        Color right = Color::YELLOW;
+
+        // From there, the rest of the cube's color layout can be deduced
+        for (unsigned short i = 0; i < NB_COLORS; ++i) {
+            const Color bottom = relations.opposites[(unsigned short) top];
+            const Color left = relations.opposites[(unsigned short) right];
+            // Rotate the cube clockwise to vary the top face (second index)
+            relations.rightFromFrontAndTop[(unsigned short) front][(unsigned short) top] = right;
+            relations.rightFromFrontAndTop[(unsigned short) front][(unsigned short) right] = bottom;
+            relations.rightFromFrontAndTop[(unsigned short) front][(unsigned short) bottom] = left;
+            relations.rightFromFrontAndTop[(unsigned short) front][(unsigned short) left] = top;
+            if (i != 2) {
+                // Three first faces for i=0,1,2
+                const Color tmp = front;
+                front = top;
+                top = right;
+                right = tmp;
+            } else {
+                // Three other faces for i=3,4,5
+                const Color tmp = top;
+                top = left;
+                right = relations.opposites[(unsigned short) tmp];
+                front = relations.opposites[(unsigned short) front];
+            }
+        }
+        return relations;
+    }
+
+    /**
+     * @brief Relations between face colors, computed at compile time
+     */
+    constexpr ColorRelations_ COLOR_RELATIONS = buildColorRelations();
+
     /**
      * @class ColorFinder
      * @brief Gathers static methods to help with colors logics
+     * @details The relations are read from compile-time tables, so that each lookup is a single load and no static
+     * initialization is needed when the library is loaded.
      */
     class ColorFinder {
         /**
@@ -20,17 +92,7 @@ namespace rubiks {
          */
         friend class CubeState_;
 
-        static const unsigned short NB_FACES = 6;  /*!< constant number of faces on a CubeState_ */
-
-        /**
-         * @brief alias for a map from a Color to another
-         */
-        using One2OneColorMap_ = std::map<Color, Color>;
-
-        /**
-         * @brief alias for a map from a pair of Colors to a Color
-         */
-        using Two2OneColorMap_ = std::map<std::pair<Color, Color>, Color>;
+        static const unsigned short NB_FACES = NB_COLORS;  /*!< constant number of faces on a CubeState_ */
 
     public:
         ColorFinder() = delete;
@@ -40,7 +102,9 @@ namespace rubiks {
          * @param frontColor Color on the front face of the CubeState_
          * @return default top Color
          */
-        static Color defaultTopColorFromFront(const Color& frontColor);
+        static constexpr Color defaultTopColorFromFront(const Color& frontColor) {
+            return COLOR_RELATIONS.defaultTops[(unsigned short) frontColor];
+        }
 
         /**
          * @brief finds the Color on a given face of the CubeState_ given the front and top Colors
@@ -49,38 +113,38 @@ namespace rubiks {
          * @param facePose relative face location on which to find the output Color
          * @return Color located at the relative facePose position to the input front and top Colors
          */
-        static Color getFromFrontAndTop(const Color &frontColor, const Color &topColor, const FacePose& facePose);
+        static constexpr Color getFromFrontAndTop(const Color &frontColor, const Color &topColor,
+                                                  const FacePose& facePose) {
+            switch (facePose) {
+                case FacePose::FRONT:
+                    return frontColor;
+                case FacePose::BACK:
+                    return getOpposite(frontColor);
+                case FacePose::RIGHT:
+                    return COLOR_RELATIONS.rightFromFrontAndTop[(unsigned short) frontColor][(unsigned short) topColor];
+                case FacePose::LEFT:
+                    return getOpposite(COLOR_RELATIONS.rightFromFrontAndTop[(unsigned short) frontColor]
+                                                                           [(unsigned short) topColor]);
+                case FacePose::TOP:
+                    return topColor;
+                case FacePose::BOTTOM:
+                    return getOpposite(topColor);
+            }
+            return Color::UNDEFINED;
+        }
 
         /**
          * @brief finds the Color on the opposite face of the input Color
          * @param color Color from which to find the opposite
          * @return Color located at the opposite position to the input Color
          */
-        static Color getOpposite(const Color &color);
-
-    private:
-        /**
-         * @brief mapping of each Color to its opposite on a CubeState_
-         */
-        static const One2OneColorMap_ oppositeMap_;
-
-        /**
-         * @brief mapping of each pair of adjacent Colors to the Color on their right
-         */
-        static const Two2OneColorMap_ rightFromFrontAndTopMap_;
-
-        /**
-         * @brief initializes ColorFinder::oppositeMap_
-         * @return value of ColorFinder::oppositeMap_
-         */
-        static One2OneColorMap_ initializeOppositeMap() noexcept;
-
-        /**
-         * @brief initializes ColorFinder::rightFromFrontAndTopMap_
-         * @return value of ColorFinder::rightFromFrontAndTopMap_
-         */
-        static Two2OneColorMap_ initializeRightFromFrontAndTopMap() noexcept;
+        static constexpr Color getOpposite(const Color &color) {
+            return COLOR_RELATIONS.opposites[(unsigned short) color];
+        }
 
     };
 
+    static_assert(ColorFinder::getFromFrontAndTop(Color::RED, Color::BLUE, FacePose::RIGHT) == Color::YELLOW,
+                  "color relations must be computable at compile time");
+
 }
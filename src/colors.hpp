@@ -1,9 +1,6 @@
 #pragma once
 
-#include <algorithm>
 #include <ostream>
-#include <string>
-#include <vector>
 
 
 namespace rubiks {
@@ -22,15 +19,25 @@ namespace rubiks {
         UNDEFINED
     };
 
+    /**
+     * @brief Number of face colors, Color::UNDEFINED excluded
+     */
+    const unsigned short NB_COLORS = 6;
+
     /**
      * @brief Alias for transparent typing of Color hash values
      */
     using HashColor = char;
 
+    /**
+     * @brief Alias for sets of face colors, one bit per Color
+     */
+    using ColorMask = unsigned short;
+
     /**
      * @brief Alias for transparent typing of hash values of arrays of Color
      */
-    using HashColorArray = std::string;
+    using HashColorArray = ColorMask;
 
     /**
      * @brief Hashes a color.
@@ -40,26 +47,34 @@ namespace rubiks {
      */
     HashColor hashColor(const Color& color);
 
+    /**
+     * @brief Returns the bit of a color in a ColorMask.
+     * @param color face color
+     * @return bitmask holding only the color, 0 for Color::UNDEFINED
+     */
+    constexpr ColorMask getColorMask(const Color& color) {
+        return color == Color::UNDEFINED ? (ColorMask) 0 : (ColorMask) (1 << (unsigned short) color);
+    }
+
     /**
      * @brief Hashes an ensemble of colors.
-     * @details Computes the hash value of each color and sorts the resulting list.
+     * @details The hash value is the bitmask of the colors, which does not depend on their order.
      * @param first Iterator pointing to the first element of the iterable
      * @param last Iterator pointing to the <i>past-the-end</i> element of the iterable
      * @return Hash value of input colors
      */
     template <class Iterator>
     HashColorArray hashColors(const Iterator& first, const Iterator& last) {
-        HashColorArray hashValue;
+        HashColorArray hashValue = 0;
         for (auto it = first; it != last; ++it) {
-            hashValue += hashColor(*it);
+            hashValue |= getColorMask(*it);
         }
-        std::sort(hashValue.begin(), hashValue.end());
         return hashValue;
     }
 
     /**
      * @brief Hashes an ensemble of colors.
-     * @details Computes the hash value of each color and sorts the resulting list.
+     * @details The hash value is the bitmask of the colors, which does not depend on their order.
      * @param array Iterable of colors
      * @return Hash value of input colors
      */
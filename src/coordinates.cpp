@@ -0,0 +1,236 @@
+#include <array>
+
+#include "coordinates.hpp"
+
+
+namespace rubiks {
+
+    namespace {
+
+        std::uint32_t binomial(unsigned short n, unsigned short k) {
+            if (k > n) return 0;
+            std::uint32_t result = 1;
+            for (unsigned short i = 1; i <= k; ++i) {
+                result = result * (n - k + i) / i;
+            }
+            return result;
+        }
+
+        const unsigned short NB_SLICE_EDGES = CubeState_::TOTAL_EDGES - FIRST_SLICE_EDGE;
+
+    }
+
+    std::uint16_t rankCornersPermutation(const CubeState_& state) {
+        std::array<unsigned char, CubeState_::TOTAL_CORNERS> corners{};
+        for (unsigned short i = 0; i < CubeState_::TOTAL_CORNERS; ++i) {
+            corners[i] = state.getCorner(i);
+        }
+        return (std::uint16_t) rankPermutation(corners.data(), CubeState_::TOTAL_CORNERS);
+    }
+
+    void unrankCornersPermutation(std::uint16_t rank, CubeState_& state) {
+        std::array<unsigned char, CubeState_::TOTAL_CORNERS> corners{};
+        unrankPermutation(rank, CubeState_::TOTAL_CORNERS, corners.data());
+        for (unsigned short i = 0; i < CubeState_::TOTAL_CORNERS; ++i) {
+            state.setCorner(i, corners[i], 0);
+        }
+    }
+
+    std::uint16_t rankCornersOrientation(const CubeState_& state) {
+        std::uint16_t rank = 0;
+        for (unsigned short i = 0; i + 1 < CubeState_::TOTAL_CORNERS; ++i) {
+            rank = (std::uint16_t) (3 * rank + state.getCornerOrientation(i));
+        }
+        return rank;
+    }
+
+    void unrankCornersOrientation(std::uint16_t rank, CubeState_& state) {
+        unsigned short twist = 0;
+        for (unsigned short i = CubeState_::TOTAL_CORNERS - 1; i-- > 0;) {
+            const auto orientation = (unsigned char) (rank % 3);
+            state.setCorner(i, state.getCorner(i), orientation);
+            twist += orientation;
+            rank = (std::uint16_t) (rank / 3);
+        }
+        // The sum of the orientations is a multiple of 3
+        const unsigned short last = CubeState_::TOTAL_CORNERS - 1;
+        state.setCorner(last, state.getCorner(last), (unsigned char) ((3 - twist % 3) % 3));
+    }
+
+    std::uint16_t rankEdgesOrientation(const CubeState_& state) {
+        std::uint16_t rank = 0;
+        for (unsigned short i = 0; i + 1 < CubeState_::TOTAL_EDGES; ++i) {
+            rank = (std::uint16_t) (2 * rank + state.getEdgeOrientation(i));
+        }
+        return rank;
+    }
+
+    void unrankEdgesOrientation(std::uint16_t rank, CubeState_& state) {
+        unsigned short flip = 0;
+        for (unsigned short i = CubeState_::TOTAL_EDGES - 1; i-- > 0;) {
+            const auto orientation = (unsigned char) (rank & 1);
+            state.setEdge(i, state.getEdge(i), orientation);
+            flip += orientation;
+            rank = (std::uint16_t) (rank >> 1);
+        }
+        // The sum of the orientations is even
+        const unsigned short last = CubeState_::TOTAL_EDGES - 1;
+        state.setEdge(last, state.getEdge(last), (unsigned char) (flip & 1));
+    }
+
+    std::uint16_t rankSliceEdgesPositions(const CubeState_& state) {
+        // Combinatorial number system on the increasing positions of the slice edges
+        std::uint16_t rank = 0;
+        unsigned short nbFound = 0;
+        for (unsigned short position = 0; position < CubeState_::TOTAL_EDGES; ++position) {
+            if (state.getEdge(position) >= FIRST_SLICE_EDGE) {
+                rank = (std::uint16_t) (rank + binomial(position, ++nbFound));
+            }
+        }
+        return rank;
+    }
+
+    void unrankSliceEdgesPositions(std::uint16_t rank, CubeState_& state) {
+        std::array<bool, CubeState_::TOTAL_EDGES> isSlicePosition{};
+        for (unsigned short k = NB_SLICE_EDGES, position = CubeState_::TOTAL_EDGES; k > 0; --k) {
+            // Greatest position whose binomial coefficient fits in the remaining rank
+            while (binomial(--position, k) > rank);
+            rank = (std::uint16_t) (rank - binomial(position, k));
+            isSlicePosition[position] = true;
+        }
+        unsigned char sliceEdge = FIRST_SLICE_EDGE, udEdge = 0;
+        for (unsigned short position = 0; position < CubeState_::TOTAL_EDGES; ++position) {
+            state.setEdge(position, isSlicePosition[position] ? sliceEdge++ : udEdge++, 0);
+        }
+    }
+
+    std::uint16_t rankUDEdgesPermutation(const CubeState_& state) {
+        std::array<unsigned char, FIRST_SLICE_EDGE> edges{};
+        for (unsigned short i = 0; i < FIRST_SLICE_EDGE; ++i) {
+            edges[i] = state.getEdge(i);
+        }
+        return (std::uint16_t) rankPermutation(edges.data(), FIRST_SLICE_EDGE);
+    }
+
+    void unrankUDEdgesPermutation(std::uint16_t rank, CubeState_& state) {
+        std::array<unsigned char, FIRST_SLICE_EDGE> edges{};
+        unrankPermutation(rank, FIRST_SLICE_EDGE, edges.data());
+        for (unsigned short i = 0; i < FIRST_SLICE_EDGE; ++i) {
+            state.setEdge(i, edges[i], 0);
+        }
+    }
+
+    std::uint16_t rankSliceEdgesPermutation(const CubeState_& state) {
+        std::array<unsigned char, NB_SLICE_EDGES> edges{};
+        for (unsigned short i = 0; i < NB_SLICE_EDGES; ++i) {
+            edges[i] = (unsigned char) (state.getEdge(FIRST_SLICE_EDGE + i) - FIRST_SLICE_EDGE);
+        }
+        return (std::uint16_t) rankPermutation(edges.data(), NB_SLICE_EDGES);
+    }
+
+    void unrankSliceEdgesPermutation(std::uint16_t rank, CubeState_& state) {
+        std::array<unsigned char, NB_SLICE_EDGES> edges{};
+        unrankPermutation(rank, NB_SLICE_EDGES, edges.data());
+        for (unsigned short i = 0; i < NB_SLICE_EDGES; ++i) {
+            state.setEdge(FIRST_SLICE_EDGE + i, (unsigned char) (FIRST_SLICE_EDGE + edges[i]), 0);
+        }
+    }
+
+    std::uint32_t rankEdgesPermutation(const CubeState_& state) {
+        std::array<unsigned char, CubeState_::TOTAL_EDGES> edges{};
+        for (unsigned short i = 0; i < CubeState_::TOTAL_EDGES; ++i) {
+            edges[i] = state.getEdge(i);
+        }
+        return rankPermutation(edges.data(), CubeState_::TOTAL_EDGES);
+    }
+
+    void unrankEdgesPermutation(std::uint32_t rank, CubeState_& state) {
+        std::array<unsigned char, CubeState_::TOTAL_EDGES> edges{};
+        unrankPermutation(rank, CubeState_::TOTAL_EDGES, edges.data());
+        for (unsigned short i = 0; i < CubeState_::TOTAL_EDGES; ++i) {
+            state.setEdge(i, edges[i], 0);
+        }
+    }
+
+    StateRank rankState(const CubeState_& state) {
+        // Single pass over the blocks, so that the loops are unrolled together
+        unsigned char corners[CubeState_::TOTAL_CORNERS];
+        unsigned char edges[CubeState_::TOTAL_EDGES];
+        std::uint32_t cornersOrientation = 0;
+        std::uint32_t edgesOrientation = 0;
+        for (unsigned short i = 0; i < CubeState_::TOTAL_CORNERS; ++i) {
+            corners[i] = state.getCorner(i);
+            if (i + 1 < CubeState_::TOTAL_CORNERS) {
+                cornersOrientation = 3 * cornersOrientation + state.getCornerOrientation(i);
+            }
+        }
+        for (unsigned short i = 0; i < CubeState_::TOTAL_EDGES; ++i) {
+            edges[i] = state.getEdge(i);
+            if (i + 1 < CubeState_::TOTAL_EDGES) edgesOrientation = 2 * edgesOrientation + state.getEdgeOrientation(i);
+        }
+        return {rankPermutation(corners, CubeState_::TOTAL_CORNERS) * NB_CORNERS_ORIENTATIONS + cornersOrientation,
+                (std::uint64_t) (rankPermutation(edges, CubeState_::TOTAL_EDGES) >> 1) * NB_EDGES_ORIENTATIONS
+                + edgesOrientation};
+    }
+
+    CubeState_ unrankState(const StateRank& rank) {
+        CubeState_ state;
+        const auto cornersPermutation = (std::uint16_t) (rank.corners / NB_CORNERS_ORIENTATIONS);
+        unrankCornersPermutation(cornersPermutation, state);
+        unrankCornersOrientation((std::uint16_t) (rank.corners % NB_CORNERS_ORIENTATIONS), state);
+
+        // The lowest digit of the edges Lehmer code gives them the parity of the corners
+        std::uint32_t edgesPermutation = (std::uint32_t) (rank.edges / NB_EDGES_ORIENTATIONS) << 1;
+        edgesPermutation |= (std::uint32_t) (getPermutationParity(edgesPermutation, CubeState_::TOTAL_EDGES)
+                                             != getPermutationParity(cornersPermutation, CubeState_::TOTAL_CORNERS));
+        unrankEdgesPermutation(edgesPermutation, state);
+        unrankEdgesOrientation((std::uint16_t) (rank.edges % NB_EDGES_ORIENTATIONS), state);
+        return state;
+    }
+
+    std::uint32_t rankEdgesGroup(const CubeState_& state, unsigned char firstEdge) {
+        std::array<unsigned char, EDGES_GROUP_SIZE> positions{};
+        std::uint32_t orientations = 0;
+        for (unsigned char position = 0; position < CubeState_::TOTAL_EDGES; ++position) {
+            const unsigned char edge = state.getEdge(position);
+            if (edge < firstEdge || edge >= firstEdge + EDGES_GROUP_SIZE) continue;
+            positions[edge - firstEdge] = position;
+            orientations |= (std::uint32_t) state.getEdgeOrientation(position) << (edge - firstEdge);
+        }
+
+        // Each position is ranked among the positions not used by the previous edges of the group
+        std::uint32_t rank = 0;
+        for (unsigned short i = 0; i < EDGES_GROUP_SIZE; ++i) {
+            unsigned short nbSmallerBefore = 0;
+            for (unsigned short j = 0; j < i; ++j) {
+                if (positions[j] < positions[i]) ++nbSmallerBefore;
+            }
+            rank = rank * (CubeState_::TOTAL_EDGES - i) + (positions[i] - nbSmallerBefore);
+        }
+        return rank * NB_EDGES_GROUP_ORIENTATIONS + orientations;
+    }
+
+    void unrankEdgesGroupPermutation(std::uint32_t rank, CubeState_& state) {
+        std::array<unsigned short, EDGES_GROUP_SIZE> freeRanks{};
+        for (unsigned short i = EDGES_GROUP_SIZE; i-- > 0;) {
+            freeRanks[i] = (unsigned short) (rank % (CubeState_::TOTAL_EDGES - i));
+            rank /= CubeState_::TOTAL_EDGES - i;
+        }
+        unsigned short used = 0;
+        for (unsigned char edge = 0; edge < EDGES_GROUP_SIZE; ++edge) {
+            // The position is the (freeRanks[edge] + 1)-th position not used yet
+            unsigned char position = 0;
+            for (unsigned short skipped = 0;; ++position) {
+                if (used & (1 << position)) continue;
+                if (skipped++ == freeRanks[edge]) break;
+            }
+            used |= (unsigned short) (1 << position);
+            state.setEdge(position, edge, 0);
+        }
+        unsigned char otherEdge = EDGES_GROUP_SIZE;
+        for (unsigned char position = 0; position < CubeState_::TOTAL_EDGES; ++position) {
+            if (!(used & (1 << position))) state.setEdge(position, otherEdge++, 0);
+        }
+    }
+
+}
@@ -0,0 +1,260 @@
+#pragma once
+
+#include <cstdint>
+
+#include "cube_state.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @brief Number of values of the coordinates of a CubeState_
+     */
+    const std::uint32_t NB_CORNERS_PERMUTATIONS = 40320;       /*!< 8! */
+    const std::uint32_t NB_CORNERS_ORIENTATIONS = 2187;        /*!< 3^7 */
+    const std::uint32_t NB_EDGES_ORIENTATIONS = 2048;          /*!< 2^11 */
+    const std::uint32_t NB_SLICE_EDGES_POSITIONS = 495;        /*!< C(12, 4) */
+    const std::uint32_t NB_UD_EDGES_PERMUTATIONS = 40320;      /*!< 8! */
+    const std::uint32_t NB_SLICE_EDGES_PERMUTATIONS = 24;      /*!< 4! */
+    const std::uint32_t NB_EDGES_GROUP_PERMUTATIONS = 665280;  /*!< 12! / 6! */
+    const std::uint32_t NB_EDGES_GROUP_ORIENTATIONS = 64;      /*!< 2^6 */
+    const std::uint32_t NB_EDGES_PERMUTATIONS = 479001600;     /*!< 12! */
+    const std::uint32_t NB_CORNERS_STATES = NB_CORNERS_PERMUTATIONS * NB_CORNERS_ORIENTATIONS;
+    const std::uint64_t NB_EDGES_STATES = (std::uint64_t) NB_EDGES_PERMUTATIONS / 2 * NB_EDGES_ORIENTATIONS;
+
+    /**
+     * @brief Number of edges of the groups ranked by rankEdgesGroup()
+     */
+    const unsigned short EDGES_GROUP_SIZE = 6;
+
+    /**
+     * @brief Index of the first of the four edges between the BLUE and GREEN faces (the slice edges)
+     * @details Edges 0 to 7 are the edges of the BLUE and GREEN faces (the UD edges).
+     */
+    const unsigned char FIRST_SLICE_EDGE = 8;
+
+    /**
+     * @brief Table of the number of bits set in the 12-bit masks, built at compile time
+     */
+    struct BitCounts_ {
+        unsigned char counts[1 << 12];
+
+        constexpr BitCounts_() : counts() {
+            for (std::uint32_t mask = 1; mask < (1 << 12); ++mask) {
+                counts[mask] = (unsigned char) (counts[mask >> 1] + (mask & 1));
+            }
+        }
+    };
+
+    constexpr BitCounts_ BIT_COUNTS{};
+
+    /**
+     * @brief Factorials of 0 to 12, the weights of the digits of the Lehmer codes
+     */
+    constexpr std::uint32_t FACTORIALS[13] = {1, 1, 2, 6, 24, 120, 720, 5040, 40320, 362880, 3628800, 39916800,
+                                              479001600};
+
+    /**
+     * @brief Computes the Lehmer code of a permutation of the values [0, length).
+     * @details Each value is ranked among the values not used by the previous ones, which are tracked by a bitmask, so
+     * that the digits of the code do not depend on each other.
+     * @param values permutation, of at most 12 values
+     * @param length number of values
+     * @return rank of the permutation (0 to length! - 1), 0 when the values are sorted
+     */
+    constexpr std::uint32_t rankPermutation(const unsigned char* values, unsigned short length) {
+        std::uint32_t rank = 0;
+        std::uint32_t used = 0;
+        for (unsigned short i = 0; i < length; ++i) {
+            const std::uint32_t bit = 1u << values[i];
+            rank += (values[i] - BIT_COUNTS.counts[used & (bit - 1)]) * FACTORIALS[length - 1 - i];
+            used |= bit;
+        }
+        return rank;
+    }
+
+    /**
+     * @brief Computes the permutation of the values [0, length) having a Lehmer code.
+     * @param rank rank of the permutation (0 to length! - 1)
+     * @param length number of values, at most 12
+     * @param values buffer receiving the permutation
+     */
+    constexpr void unrankPermutation(std::uint32_t rank, unsigned short length, unsigned char* values) {
+        // Digits of the code, the last one first
+        for (unsigned short i = length; i-- > 0;) {
+            values[i] = (unsigned char) (rank % (length - i));
+            rank /= length - i;
+        }
+        std::uint32_t available = (1u << length) - 1;
+        for (unsigned short i = 0; i < length; ++i) {
+            // The value is the lowest available one, after skipping as many available values as the digit
+            std::uint32_t candidates = available;
+            for (unsigned char skipped = 0; skipped < values[i]; ++skipped) candidates &= candidates - 1;
+            const std::uint32_t bit = candidates & (~candidates + 1);
+            values[i] = BIT_COUNTS.counts[bit - 1];
+            available &= ~bit;
+        }
+    }
+
+    /**
+     * @brief Computes the parity of a permutation from its Lehmer code, as the parity of the sum of its digits.
+     * @param rank rank of the permutation (0 to length! - 1)
+     * @param length number of values
+     * @return true if the permutation is odd, false otherwise
+     */
+    constexpr bool getPermutationParity(std::uint32_t rank, unsigned short length) {
+        unsigned short sum = 0;
+        for (unsigned short base = 1; base <= length; ++base) {
+            sum += (unsigned short) (rank % base);
+            rank /= base;
+        }
+        return sum & 1;
+    }
+
+    /**
+     * @brief Ranks the permutation of the corners.
+     * @param state cube state
+     * @return Lehmer code of the corners permutation (0-40319), 0 when the corners are sorted
+     */
+    std::uint16_t rankCornersPermutation(const CubeState_& state);
+
+    /**
+     * @brief Places the corners according to a permutation rank, with orientations 0.
+     * @param rank Lehmer code of the corners permutation (0-40319)
+     * @param state cube state to modify
+     */
+    void unrankCornersPermutation(std::uint16_t rank, CubeState_& state);
+
+    /**
+     * @brief Ranks the orientations of the corners.
+     * @param state cube state
+     * @return orientations of the seven first corner positions in base 3 (0-2186), 0 when they are all oriented
+     */
+    std::uint16_t rankCornersOrientation(const CubeState_& state);
+
+    /**
+     * @brief Orients the corners according to an orientation rank, without moving them.
+     * @details The orientation of the last corner position is deduced from the others.
+     * @param rank orientations of the seven first corner positions in base 3 (0-2186)
+     * @param state cube state to modify
+     */
+    void unrankCornersOrientation(std::uint16_t rank, CubeState_& state);
+
+    /**
+     * @brief Ranks the orientations of the edges.
+     * @param state cube state
+     * @return orientations of the eleven first edge positions in base 2 (0-2047), 0 when they are all oriented
+     */
+    std::uint16_t rankEdgesOrientation(const CubeState_& state);
+
+    /**
+     * @brief Orients the edges according to an orientation rank, without moving them.
+     * @details The orientation of the last edge position is deduced from the others.
+     * @param rank orientations of the eleven first edge positions in base 2 (0-2047)
+     * @param state cube state to modify
+     */
+    void unrankEdgesOrientation(std::uint16_t rank, CubeState_& state);
+
+    /**
+     * @brief Ranks the set of positions occupied by the slice edges, regardless of their order.
+     * @param state cube state
+     * @return combination rank of the positions (0-494), 494 when the slice edges are in the slice
+     */
+    std::uint16_t rankSliceEdgesPositions(const CubeState_& state);
+
+    /**
+     * @brief Places the slice edges according to a positions rank, the UD edges filling the other positions in order.
+     * @details All the edges get orientation 0.
+     * @param rank combination rank of the positions (0-494)
+     * @param state cube state to modify
+     */
+    void unrankSliceEdgesPositions(std::uint16_t rank, CubeState_& state);
+
+    /**
+     * @brief Ranks the permutation of the UD edges, which must be located on the UD edges positions.
+     * @param state cube state
+     * @return Lehmer code of the UD edges permutation (0-40319), 0 when they are sorted
+     */
+    std::uint16_t rankUDEdgesPermutation(const CubeState_& state);
+
+    /**
+     * @brief Places the UD edges on the UD edges positions according to a permutation rank, with orientations 0.
+     * @param rank Lehmer code of the UD edges permutation (0-40319)
+     * @param state cube state to modify
+     */
+    void unrankUDEdgesPermutation(std::uint16_t rank, CubeState_& state);
+
+    /**
+     * @brief Ranks the permutation of the slice edges, which must be located in the slice.
+     * @param state cube state
+     * @return Lehmer code of the slice edges permutation (0-23), 0 when they are sorted
+     */
+    std::uint16_t rankSliceEdgesPermutation(const CubeState_& state);
+
+    /**
+     * @brief Places the slice edges in the slice according to a permutation rank, with orientations 0.
+     * @param rank Lehmer code of the slice edges permutation (0-23)
+     * @param state cube state to modify
+     */
+    void unrankSliceEdgesPermutation(std::uint16_t rank, CubeState_& state);
+
+    /**
+     * @brief Ranks the permutation of all the edges.
+     * @param state cube state
+     * @return Lehmer code of the edges permutation (0-479001599), 0 when the edges are sorted
+     */
+    std::uint32_t rankEdgesPermutation(const CubeState_& state);
+
+    /**
+     * @brief Places all the edges according to a permutation rank, with orientations 0.
+     * @param rank Lehmer code of the edges permutation (0-479001599)
+     * @param state cube state to modify
+     */
+    void unrankEdgesPermutation(std::uint32_t rank, CubeState_& state);
+
+    /**
+     * @struct StateRank
+     * @brief Rank of a solvable state, split between the corners and the edges
+     * @details The 43,252,003,274,489,856,000 solvable states need 66 bits (about 2^65.2), so they cannot be ranked
+     * on 64 bits. <tt>corners * NB_EDGES_STATES + edges</tt> is a dense rank of the states, which can be computed on
+     * 128 bits where needed; the two parts are dense ranks on their own and fit 32 and 64 bits.
+     */
+    struct StateRank {
+        std::uint32_t corners;  /*!< corners permutation * NB_CORNERS_ORIENTATIONS + orientation (0-88179839) */
+        std::uint64_t edges;    /*!< edges permutation / 2 * NB_EDGES_ORIENTATIONS + orientation (0-490497638399) */
+    };
+
+    /**
+     * @brief Ranks a solvable state.
+     * @details The edges permutation has the parity of the corners permutation, which determines the lowest bit of its
+     * Lehmer code: the edges permutation is ranked by its Lehmer code divided by 2.
+     * @param state solvable cube state
+     * @return rank of the state, {0, 0} for the sorted state
+     */
+    StateRank rankState(const CubeState_& state);
+
+    /**
+     * @brief Computes the solvable state having a rank.
+     * @param rank rank of the state, as returned by rankState()
+     * @return state having the rank
+     */
+    CubeState_ unrankState(const StateRank& rank);
+
+    /**
+     * @brief Ranks the positions and orientations of a group of EDGES_GROUP_SIZE consecutive edges.
+     * @param state cube state
+     * @param firstEdge index of the first edge of the group
+     * @return rank of the ordered positions of the edges (0-665279) times 64, plus the orientations of the edges
+     */
+    std::uint32_t rankEdgesGroup(const CubeState_& state, unsigned char firstEdge);
+
+    /**
+     * @brief Places the edges 0-5 according to a rank of their ordered positions, the edges 6-11 filling the other
+     * positions in order.
+     * @details All the edges get orientation 0.
+     * @param rank rank of the ordered positions of the edges 0-5 (0-665279)
+     * @param state cube state to modify
+     */
+    void unrankEdgesGroupPermutation(std::uint32_t rank, CubeState_& state);
+
+}
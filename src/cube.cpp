@@ -1,5 +1,6 @@
 #include <iostream>
 #include "cube.hpp"
+#include "stats.hpp"
 
 
 namespace rubiks {
@@ -22,9 +23,9 @@ namespace rubiks {
     Cube::Cube(const Color &frontColor, const Color &topColor, unsigned int nbShuffle):
             frontColor_(frontColor),
             topColor_(topColor),
+            faceletLayout_(nullptr),
             state_(),
-            rotationGenerator_(_getAllRotations()),
-            faceGenerator_(_getAllFacePoses()) {
+            moveObserver_(nullptr) {
         resetState();
         if (topColor_ == ColorFinder::getOpposite(frontColor_)) {
             topColor_ = ColorFinder::defaultTopColorFromFront(frontColor_);
@@ -32,6 +33,7 @@ namespace rubiks {
                       << " and top color " << topColor << " whereas those colors must be opposite" << std::endl
                       << "[Cube] Using default top color " << topColor_ << " instead" << std::endl;
         }
+        faceletLayout_ = &getFaceletLayout(frontColor_, topColor_);
         if (nbShuffle) shuffle(nbShuffle);
     }
 
@@ -44,13 +46,16 @@ namespace rubiks {
     }
 
     void Cube::shuffle(unsigned int nbShuffles) {
+        shuffle(nbShuffles, ScrambleGenerator::forThread());
+    }
+
+    void Cube::shuffle(unsigned int nbShuffles, ScrambleGenerator &generator) {
+        unsigned short lastMove = NB_MOVES;
         for (unsigned int i=0; i<nbShuffles; ++i) {
-            // Pick a random face
-            FacePose facePose = faceGenerator_.draw();
-            // Pick a random rotation direction
-            Rotation rotation = rotationGenerator_.draw();
-            // Rotate
-            rotate(facePose, rotation);
+            // Pick a random move that does not cancel or commute with the previous one
+            lastMove = generator.drawMove(lastMove);
+            const Move move = getMove(lastMove);
+            rotate(move.faceColor, move.rotation);
         }
     }
 
@@ -62,84 +67,137 @@ namespace rubiks {
     void Cube::rotate(const Color &faceColor, const Rotation &rotation) {
         if (faceColor == Color::UNDEFINED)
             return;
-        std::cout << "Rotating face of color " << faceColor << " " << rotation << std::endl;
         state_.rotateFace(faceColor, rotation);
+        if (moveObserver_) moveObserver_->onMove({faceColor, rotation});
     }
 
-    std::array<std::array<Color, 3>, 3> Cube::getFace(const FacePose &facePose) const {
-        const Color frontFaceColor = ColorFinder::getFromFrontAndTop(frontColor_, topColor_, facePose);
-        Color topFaceColor;
-        switch (facePose) {
-            case FacePose::FRONT:
-            case FacePose::LEFT:
-            case FacePose::RIGHT:
-                topFaceColor = topColor_;
-                break;
-            case FacePose::BACK:
-                topFaceColor = ColorFinder::getOpposite(topColor_);
-                break;
-            case FacePose::TOP:
-                topFaceColor = ColorFinder::getOpposite(frontColor_);
-                break;
-            case FacePose::BOTTOM:
-                topFaceColor = frontColor_;
-                break;
+    void Cube::rotate(const std::string &notation) {
+        for (const Move& move: parseMoves(notation, frontColor_, topColor_)) {
+            rotate(move.faceColor, move.rotation);
         }
+    }
 
-        const Color bottomFaceColor = ColorFinder::getOpposite(topFaceColor);
-        const Color rightFaceColor = ColorFinder::getFromFrontAndTop(frontFaceColor, topFaceColor, FacePose::RIGHT);
-        const Color leftFaceColor = ColorFinder::getOpposite(rightFaceColor);
-
-        std::map<Color, Color*> edgesColorsMap;
-        std::array<Color, CubeState_::EDGES_PER_FACE> edgesColors{};
-        unsigned int edgeCpt = 0;
-        for (const auto edgePtr: state_.getFaceEdges(frontFaceColor)) {
-            for (const auto& blockFace: edgePtr->blockColors()) {
-                if (blockFace.second == frontFaceColor) {
-                    edgesColors[edgeCpt] = blockFace.first;
-                }
-                else {
-                    edgesColorsMap[blockFace.second] = edgesColors.data() + edgeCpt;
-                }
+    void Cube::pushMove(const FacePose &facePose, const Rotation &rotation) {
+        const Color rotatingFaceColor = ColorFinder::getFromFrontAndTop(frontColor_, topColor_, facePose);
+        pushMove(rotatingFaceColor, rotation);
+    }
+
+    void Cube::pushMove(const Color &faceColor, const Rotation &rotation) {
+        if (faceColor == Color::UNDEFINED)
+            return;
+        rotate(faceColor, rotation);
+        undoHistory_.push_back({faceColor, rotation});
+        redoHistory_.clear();
+    }
+
+    bool Cube::popMove() {
+        if (undoHistory_.empty())
+            return false;
+        const Move move = undoHistory_.back();
+        undoHistory_.pop_back();
+        const Move inverseMove = invertMove(move);
+        rotate(inverseMove.faceColor, inverseMove.rotation);
+        redoHistory_.push_back(move);
+        return true;
+    }
+
+    bool Cube::redoMove() {
+        if (redoHistory_.empty())
+            return false;
+        const Move move = redoHistory_.back();
+        redoHistory_.pop_back();
+        rotate(move.faceColor, move.rotation);
+        undoHistory_.push_back(move);
+        return true;
+    }
+
+    void Cube::clearHistory() {
+        undoHistory_.clear();
+        redoHistory_.clear();
+    }
+
+    void Cube::reset() {
+        static const CubeState_ sortedState;
+        state_ = sortedState;
+        clearHistory();
+        moveObserver_ = nullptr;
+    }
+
+    void Cube::setMoveObserver(MoveObserver *moveObserver) {
+        moveObserver_ = moveObserver;
+    }
+
+    const CubeState_& Cube::getState() const {
+        return state_;
+    }
+
+    std::array<std::array<Color, 3>, 3> Cube::getFace(const FacePose &facePose) const {
+        countStat(Stat::GET_FACE_CALLS);
+        const unsigned char* facelets = faceletLayout_->data() + 9 * (unsigned short) facePose;
+        std::array<std::array<Color, 3>, 3> face{};
+        for (unsigned short row = 0; row < 3; ++row) {
+            for (unsigned short column = 0; column < 3; ++column) {
+                face[row][column] = state_.getFacelet(facelets[3 * row + column]);
             }
-            ++edgeCpt;
         }
-        const Color topBlockColor = *edgesColorsMap[topFaceColor];
-        const Color leftBlockColor = *edgesColorsMap[leftFaceColor];
-        const Color rightBlockColor = *edgesColorsMap[rightFaceColor];
-        const Color bottomBlockColor = *edgesColorsMap[bottomFaceColor];
-
-        std::map<HashColorArray, Color> cornersColorsMap;
-        std::array<Color, CubeState_::CORNERS_PER_FACE> cornersColors{};
-        for (const auto cornerPtr: state_.getFaceCorners(frontFaceColor)) {
-            std::array<Color, 2> otherColors{};
-            unsigned int otherColorCpt = 0;
-            Color colorOnThisFace = Color::UNDEFINED;
-            for (const auto& blockFace: cornerPtr->blockColors()) {
-                if (blockFace.second == frontFaceColor) {
-                    colorOnThisFace = blockFace.first;
-                }
-                else {
-                    otherColors[otherColorCpt++] = blockFace.second;
+        return face;
+    }
+
+    std::array<Color, CubeState_::NB_FACELETS> Cube::getAllFacelets() const {
+        const std::array<Color, CubeState_::NB_FACELETS> colors = state_.getFacelets();
+        std::array<Color, CubeState_::NB_FACELETS> facelets{};
+        for (unsigned short i = 0; i < CubeState_::NB_FACELETS; ++i) {
+            facelets[i] = colors[(*faceletLayout_)[i]];
+        }
+        return facelets;
+    }
+
+    const Cube::FaceletLayout_& Cube::getFaceletLayout(const Color &frontColor, const Color &topColor) {
+        static const std::array<std::array<FaceletLayout_, CubeState_::NB_FACES>, CubeState_::NB_FACES> layouts = []() {
+            std::array<std::array<FaceletLayout_, CubeState_::NB_FACES>, CubeState_::NB_FACES> allLayouts{};
+            for (unsigned short front = 0; front < CubeState_::NB_FACES; ++front) {
+                for (unsigned short top = 0; top < CubeState_::NB_FACES; ++top) {
+                    const auto cubeFrontColor = (Color) front, cubeTopColor = (Color) top;
+                    if (cubeTopColor == cubeFrontColor || cubeTopColor == ColorFinder::getOpposite(cubeFrontColor))
+                        continue;
+                    for (const FacePose facePose: _getAllFacePoses()) {
+                        const Color faceColor = ColorFinder::getFromFrontAndTop(cubeFrontColor, cubeTopColor, facePose);
+                        Color upColor = cubeTopColor;
+                        switch (facePose) {
+                            case FacePose::FRONT:
+                            case FacePose::LEFT:
+                            case FacePose::RIGHT:
+                                break;
+                            case FacePose::BACK:
+                                upColor = ColorFinder::getOpposite(cubeTopColor);
+                                break;
+                            case FacePose::TOP:
+                                upColor = ColorFinder::getOpposite(cubeFrontColor);
+                                break;
+                            case FacePose::BOTTOM:
+                                upColor = cubeFrontColor;
+                                break;
+                        }
+                        const Color downColor = ColorFinder::getOpposite(upColor);
+                        const Color rightColor = ColorFinder::getFromFrontAndTop(faceColor, upColor, FacePose::RIGHT);
+                        const Color leftColor = ColorFinder::getOpposite(rightColor);
+
+                        unsigned char* facelets = allLayouts[front][top].data() + 9 * (unsigned short) facePose;
+                        facelets[0] = (unsigned char) CubeState_::getCornerFacelet(faceColor, upColor, leftColor);
+                        facelets[1] = (unsigned char) CubeState_::getEdgeFacelet(faceColor, upColor);
+                        facelets[2] = (unsigned char) CubeState_::getCornerFacelet(faceColor, upColor, rightColor);
+                        facelets[3] = (unsigned char) CubeState_::getEdgeFacelet(faceColor, leftColor);
+                        facelets[4] = (unsigned char) CubeState_::getCenterFacelet(faceColor);
+                        facelets[5] = (unsigned char) CubeState_::getEdgeFacelet(faceColor, rightColor);
+                        facelets[6] = (unsigned char) CubeState_::getCornerFacelet(faceColor, downColor, leftColor);
+                        facelets[7] = (unsigned char) CubeState_::getEdgeFacelet(faceColor, downColor);
+                        facelets[8] = (unsigned char) CubeState_::getCornerFacelet(faceColor, downColor, rightColor);
+                    }
                 }
             }
-            const HashColorArray adjacentFacesHash = hashColors(otherColors.begin(), otherColors.end());
-            cornersColorsMap[adjacentFacesHash] = colorOnThisFace;
-        }
-        std::array<Color, 2> topLeftFaceColors = {topFaceColor, leftFaceColor};
-        const Color topLeftBlockColor = cornersColorsMap[hashColors(topLeftFaceColors)];
-        std::array<Color, 2> topRightFaceColors = {topFaceColor, rightFaceColor};
-        const Color topRightBlockColor = cornersColorsMap[hashColors(topRightFaceColors)];
-        std::array<Color, 2> bottomLeftFaceColors = {bottomFaceColor, leftFaceColor};
-        const Color bottomLeftBlockColor = cornersColorsMap[hashColors(bottomLeftFaceColors)];
-        std::array<Color, 2> bottomRightFaceColors = {bottomFaceColor, rightFaceColor};
-        const Color bottomRightBlockColor = cornersColorsMap[hashColors(bottomRightFaceColors)];
-
-        return {
-                std::array<Color, 3>{topLeftBlockColor, topBlockColor, topRightBlockColor},
-                std::array<Color, 3>{leftBlockColor, frontFaceColor, rightBlockColor},
-                std::array<Color, 3>{bottomLeftBlockColor, bottomBlockColor, bottomRightBlockColor}
-        };
+            return allLayouts;
+        }();
+        return layouts[(unsigned short) frontColor][(unsigned short) topColor];
     }
 
     std::ostream &operator<<(std::ostream &os, const Cube &cube) {
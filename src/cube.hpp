@@ -2,14 +2,18 @@
 
 #include <utility>
 #include <array>
-#include <map>
+#include <string>
+#include <vector>
 
 #include "colors.hpp"
 #include "color_finder.hpp"
 #include "cube_state.hpp"
+#include "move_observer.hpp"
+#include "moves.hpp"
 #include "positions.hpp"
-#include "random.hpp"
 #include "rotations.hpp"
+#include "scramble.hpp"
+#include "sequences.hpp"
 #include "types.hpp"
 
 
@@ -70,10 +74,18 @@ namespace rubiks {
 
         /**
          * @brief randomly shuffles the cube the given number of times
+         * @details The moves are drawn from the scramble generator of the calling thread.
          * @param nbShuffles number of times to shuffle the cube
          */
         void shuffle(unsigned int nbShuffles = 20);
 
+        /**
+         * @brief randomly shuffles the cube the given number of times, with reproducible moves
+         * @param nbShuffles number of times to shuffle the cube
+         * @param generator generator drawing the moves
+         */
+        void shuffle(unsigned int nbShuffles, ScrambleGenerator& generator);
+
         /**
          * @brief rotates the given face (chosen by the color of its middle block) in the given direction
          * @param faceColor face color to rotate
@@ -81,6 +93,13 @@ namespace rubiks {
          */
         void rotate(const Color& faceColor, const Rotation& rotation);
 
+        /**
+         * @brief rotates the faces following a sequence written in the standard notation (see parseMoves())
+         * @details The faces are located relatively to the front and top colors of the cube.
+         * @param notation sequence of moves, such as "R U R' U2"
+         */
+        void rotate(const std::string& notation);
+
         /**
          * @brief rotates the given face (chosen by its pose) in the given direction
          * @param facePose face pose to rotate
@@ -88,24 +107,106 @@ namespace rubiks {
          */
         void rotate(const FacePose& facePose, const Rotation& rotation);
 
+        /**
+         * @brief rotates the given face (chosen by the color of its middle block) and records the move so that it can
+         * be undone
+         * @details recording a move discards the moves that were undone and not redone yet
+         * @param faceColor face color to rotate
+         * @param rotation rotation direction
+         */
+        void pushMove(const Color& faceColor, const Rotation& rotation);
+
+        /**
+         * @brief rotates the given face (chosen by its pose) and records the move so that it can be undone
+         * @param facePose face pose to rotate
+         * @param rotation rotation direction
+         */
+        void pushMove(const FacePose& facePose, const Rotation& rotation);
+
+        /**
+         * @brief undoes the last recorded move, restoring the previous state in constant time
+         * @return true if a move was undone, false if there was no recorded move
+         */
+        bool popMove();
+
+        /**
+         * @brief re-applies the last undone move
+         * @return true if a move was redone, false if there was no undone move
+         */
+        bool redoMove();
+
+        /**
+         * @brief forgets all the recorded and undone moves, without changing the cube state
+         */
+        void clearHistory();
+
+        /**
+         * @brief restores the sorted state in place, forgets the recorded moves and detaches the observer
+         * @details The state is copied from a sorted template and the histories keep their capacity, so that a cube can
+         * be reused without allocation (see CubeArena).
+         */
+        void reset();
+
+        /**
+         * @brief attaches an observer notified of every face rotation, replacing the previous one
+         * @details rotations are not traced when no observer is attached
+         * @param moveObserver observer to notify, it must outlive the cube or be detached; nullptr to detach it
+         */
+        void setMoveObserver(MoveObserver* moveObserver);
+
+        /**
+         * @brief retrieves the cube state, which can be copied to fork the cube configuration
+         * @return state of the cube
+         */
+        const CubeState_& getState() const;
+
+        /**
+         * @brief retrieves the colors displayed on a face, as seen from the front of the cube
+         * @details The colors are read through a precomputed facelet layout, in constant time and without allocation.
+         * @param facePose pose of the face
+         * @return colors of the face, row by row from the top
+         */
         std::array<std::array<Color, 3>, 3> getFace(const FacePose& facePose) const;
 
+        /**
+         * @brief retrieves the colors displayed on all the faces, without allocation
+         * @return colors of the faces ordered as the FacePose values, each one laid out as by getFace(), row by row
+         */
+        std::array<Color, CubeState_::NB_FACELETS> getAllFacelets() const;
+
         friend std::ostream &operator<<(std::ostream &os, const Cube &cube);
 
     private:
+        /**
+         * @brief alias for the facelet index displayed at each cell of each face pose
+         */
+        using FaceletLayout_ = std::array<unsigned char, CubeState_::NB_FACELETS>;
+
         Color frontColor_;
         Color topColor_;
 
+        const FaceletLayout_* faceletLayout_;  /*!< layout matching the front and top colors, statically allocated */
+
         CubeState_ state_;
 
-        RandomRotationGenerator_ rotationGenerator_;
-        RandomCubeFaceGenerator_ faceGenerator_;
+        std::vector<Move> undoHistory_;  /*!< recorded moves, the most recent last */
+        std::vector<Move> redoHistory_;  /*!< undone moves, the most recently undone last */
+
+        MoveObserver* moveObserver_;     /*!< optional observer of the rotations, not owned */
 
         /**
          * @brief resets the cube to a sorted state
          */
         void resetState();
 
+        /**
+         * @brief retrieves the facelet layout of a cube orientation, building the layouts on the first call
+         * @param frontColor color of the front face
+         * @param topColor color of the top face, adjacent to the front face
+         * @return layout of the orientation
+         */
+        static const FaceletLayout_& getFaceletLayout(const Color& frontColor, const Color& topColor);
+
     };
 
     /**
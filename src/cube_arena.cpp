@@ -0,0 +1,39 @@
+#include <iostream>
+
+#include "cube_arena.hpp"
+
+
+namespace rubiks {
+
+    CubeArena::CubeArena(std::size_t capacity, const Color& frontColor, const Color& topColor)
+            : cubes_(), nbAcquired_(0) {
+        cubes_.reserve(capacity);
+        for (std::size_t i = 0; i < capacity; ++i) {
+            cubes_.emplace_back(frontColor, topColor);
+        }
+    }
+
+    Cube* CubeArena::acquire() {
+        if (nbAcquired_ == cubes_.size()) {
+            std::cerr << "[CubeArena] WARNING: all the " << cubes_.size() << " cubes of the arena are in use"
+                      << std::endl;
+            return nullptr;
+        }
+        Cube& cube = cubes_[nbAcquired_++];
+        cube.reset();
+        return &cube;
+    }
+
+    void CubeArena::releaseAll() {
+        nbAcquired_ = 0;
+    }
+
+    std::size_t CubeArena::size() const {
+        return nbAcquired_;
+    }
+
+    std::size_t CubeArena::capacity() const {
+        return cubes_.size();
+    }
+
+}
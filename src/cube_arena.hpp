@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "cube.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @class CubeArena
+     * @brief Pool of cubes constructed once in contiguous memory, handed out sorted and released all together
+     * @details The cubes are constructed by the arena constructor, which is its only allocation. Each call to acquire()
+     * resets the next cube in place (see Cube::reset()), so the cubes handed out never call the allocator unless their
+     * move histories outgrow what they held before. releaseAll() only rewinds the arena. An arena is meant to be used
+     * by a single thread, typically one arena per worker.
+     */
+    class CubeArena {
+    public:
+        /**
+         * @brief constructs the cubes of the arena
+         * @param capacity maximum number of cubes handed out between two calls to releaseAll()
+         * @param frontColor front color of the cubes
+         * @param topColor top color of the cubes, adjacent to the front color
+         */
+        explicit CubeArena(std::size_t capacity, const Color& frontColor = Color::RED,
+                           const Color& topColor = Color::WHITE);
+
+        CubeArena(const CubeArena&) = delete;
+        CubeArena& operator=(const CubeArena&) = delete;
+
+        /**
+         * @brief hands out a sorted cube, valid until the next call to releaseAll()
+         * @return cube owned by the arena, nullptr if all the cubes are handed out
+         */
+        Cube* acquire();
+
+        /**
+         * @brief takes back all the cubes handed out, in constant time
+         * @details The cubes are reset when they are handed out again, the pointers to them must not be used anymore.
+         */
+        void releaseAll();
+
+        /**
+         * @brief returns the number of cubes handed out since the last call to releaseAll()
+         * @return number of cubes in use
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief returns the number of cubes of the arena
+         * @return number of cubes
+         */
+        std::size_t capacity() const;
+
+    private:
+        std::vector<Cube> cubes_;
+        std::size_t nbAcquired_;  /*!< cubes handed out are the first ones */
+    };
+
+}
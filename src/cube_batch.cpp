@@ -0,0 +1,227 @@
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#include "cube_batch.hpp"
+#include "stats.hpp"
+
+
+namespace rubiks {
+
+    namespace {
+
+        const std::size_t NB_COLUMNS = 2 * CubeState_::TOTAL_CORNERS + 2 * CubeState_::TOTAL_EDGES;
+        const std::size_t CORNERS_ORIENTATION = CubeState_::TOTAL_CORNERS;
+        const std::size_t EDGES_PERMUTATION = 2 * CubeState_::TOTAL_CORNERS;
+        const std::size_t EDGES_ORIENTATION = EDGES_PERMUTATION + CubeState_::TOTAL_EDGES;
+        const std::size_t COLUMN_ALIGNMENT = 64;  /*!< columns start on distinct cache lines */
+
+        /**
+         * @brief Face turn applied to the columns of a tile
+         */
+        struct ColumnTurn_ {
+            unsigned char sources[NB_COLUMNS];  /*!< column moved to each column */
+            unsigned char changes[NB_COLUMNS];  /*!< twist or flip then added to the orientation columns */
+        };
+
+        /**
+         * @brief Builds the column turns of the moves, from the face turns of a sorted CubeState_
+         */
+        struct ColumnTurns_ {
+            ColumnTurn_ turns[NB_MOVES];
+
+            ColumnTurns_() : turns() {
+                for (unsigned short index = 0; index < NB_MOVES; ++index) {
+                    const Move move = getMove(index);
+                    CubeState_ state;
+                    state.rotateFace(move.faceColor, move.rotation);
+                    ColumnTurn_& turn = turns[index];
+                    for (unsigned short i = 0; i < CubeState_::TOTAL_CORNERS; ++i) {
+                        turn.sources[i] = state.getCorner(i);
+                        turn.sources[CORNERS_ORIENTATION + i] =
+                                (unsigned char) (CORNERS_ORIENTATION + state.getCorner(i));
+                        turn.changes[CORNERS_ORIENTATION + i] = state.getCornerOrientation(i);
+                    }
+                    for (unsigned short i = 0; i < CubeState_::TOTAL_EDGES; ++i) {
+                        turn.sources[EDGES_PERMUTATION + i] = (unsigned char) (EDGES_PERMUTATION + state.getEdge(i));
+                        turn.sources[EDGES_ORIENTATION + i] = (unsigned char) (EDGES_ORIENTATION + state.getEdge(i));
+                        turn.changes[EDGES_ORIENTATION + i] = state.getEdgeOrientation(i);
+                    }
+                }
+            }
+        };
+
+        const ColumnTurn_& getColumnTurn(const Move& move) {
+            static const ColumnTurns_ columnTurns;
+            return columnTurns.turns[getMoveIndex(move)];
+        }
+
+        std::size_t getStride(std::size_t size) {
+            return (size + COLUMN_ALIGNMENT - 1) / COLUMN_ALIGNMENT * COLUMN_ALIGNMENT;
+        }
+
+        unsigned char getSortedValue(std::size_t column) {
+            if (column < CORNERS_ORIENTATION) return (unsigned char) column;
+            if (column < EDGES_PERMUTATION) return 0;
+            if (column < EDGES_ORIENTATION) return (unsigned char) (column - EDGES_PERMUTATION);
+            return 0;
+        }
+
+        void countMoves(const Move* moves, std::size_t nbMoves, std::size_t nbStates) {
+            for (std::size_t i = 0; i < nbMoves; ++i) {
+                countFaceTurns(moves[i].faceColor, nbStates);
+            }
+        }
+
+        bool areValid(const Move* moves, std::size_t nbMoves) {
+            for (std::size_t i = 0; i < nbMoves; ++i) {
+                if (moves[i].faceColor == Color::UNDEFINED) {
+                    std::cerr << "[CubeBatch] WARNING: Attempt to rotate a face of color \"Color::UNDEFINED\""
+                              << std::endl << "[CubeBatch] Ignoring the moves" << std::endl;
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    }
+
+    CubeBatch::CubeBatch(std::size_t size)
+            : size_(size), stride_(getStride(size)), columns_(NB_COLUMNS * stride_) {
+        for (std::size_t column = 0; column < NB_COLUMNS; ++column) {
+            std::memset(columns_.data() + column * stride_, getSortedValue(column), size_);
+        }
+    }
+
+    CubeBatch::CubeBatch(const std::vector<CubeState_>& states)
+            : size_(states.size()), stride_(getStride(states.size())), columns_(NB_COLUMNS * stride_) {
+        for (std::size_t index = 0; index < size_; ++index) {
+            setState(index, states[index]);
+        }
+    }
+
+    std::size_t CubeBatch::size() const {
+        return size_;
+    }
+
+    CubeState_ CubeBatch::getState(std::size_t index) const {
+        CubeState_ state;
+        if (index >= size_) {
+            std::cerr << "[CubeBatch] WARNING: no state at index " << index << " of a batch of " << size_ << std::endl;
+            return state;
+        }
+        const unsigned char* column = columns_.data() + index;
+        for (unsigned short i = 0; i < CubeState_::TOTAL_CORNERS; ++i) {
+            state.setCorner(i, column[i * stride_], column[(CORNERS_ORIENTATION + i) * stride_]);
+        }
+        for (unsigned short i = 0; i < CubeState_::TOTAL_EDGES; ++i) {
+            state.setEdge(i, column[(EDGES_PERMUTATION + i) * stride_], column[(EDGES_ORIENTATION + i) * stride_]);
+        }
+        return state;
+    }
+
+    void CubeBatch::setState(std::size_t index, const CubeState_& state) {
+        if (index >= size_) {
+            std::cerr << "[CubeBatch] WARNING: no state at index " << index << " of a batch of " << size_ << std::endl;
+            return;
+        }
+        unsigned char* column = columns_.data() + index;
+        for (unsigned short i = 0; i < CubeState_::TOTAL_CORNERS; ++i) {
+            column[i * stride_] = state.getCorner(i);
+            column[(CORNERS_ORIENTATION + i) * stride_] = state.getCornerOrientation(i);
+        }
+        for (unsigned short i = 0; i < CubeState_::TOTAL_EDGES; ++i) {
+            column[(EDGES_PERMUTATION + i) * stride_] = state.getEdge(i);
+            column[(EDGES_ORIENTATION + i) * stride_] = state.getEdgeOrientation(i);
+        }
+    }
+
+    std::size_t CubeBatch::countSorted() const {
+        std::size_t nbSorted = 0;
+        unsigned char sorted[TILE_SIZE];
+        for (std::size_t first = 0; first < size_; first += TILE_SIZE) {
+            const std::size_t length = std::min(TILE_SIZE, size_ - first);
+            std::memset(sorted, 1, length);
+            for (std::size_t column = 0; column < NB_COLUMNS; ++column) {
+                const unsigned char* values = columns_.data() + column * stride_ + first;
+                const unsigned char expected = getSortedValue(column);
+                for (std::size_t i = 0; i < length; ++i) {
+                    sorted[i] &= (unsigned char) (values[i] == expected);
+                }
+            }
+            for (std::size_t i = 0; i < length; ++i) {
+                nbSorted += sorted[i];
+            }
+        }
+        return nbSorted;
+    }
+
+    void CubeBatch::applyMove(const Move& move) {
+        if (!areValid(&move, 1)) return;
+        countMoves(&move, 1, size_);
+        for (std::size_t tile = 0; tile < nbTiles(); ++tile) {
+            applyToTile(&move, 1, tile);
+        }
+    }
+
+    void CubeBatch::applySequence(const std::vector<Move>& moves) {
+        if (moves.empty() || !areValid(moves.data(), moves.size())) return;
+        countMoves(moves.data(), moves.size(), size_);
+        for (std::size_t tile = 0; tile < nbTiles(); ++tile) {
+            applyToTile(moves.data(), moves.size(), tile);
+        }
+    }
+
+    void CubeBatch::applySequence(const std::vector<Move>& moves, WorkStealingPool& pool) {
+        if (moves.empty() || !areValid(moves.data(), moves.size())) return;
+        countMoves(moves.data(), moves.size(), size_);
+        pool.parallelFor(nbTiles(), [this, &moves](std::size_t tile) {
+            applyToTile(moves.data(), moves.size(), tile);
+        });
+    }
+
+    void CubeBatch::applyToTile(const Move* moves, std::size_t nbMoves, std::size_t tile) {
+        const std::size_t first = tile * TILE_SIZE;
+        const std::size_t length = std::min(TILE_SIZE, size_ - first);
+        alignas(COLUMN_ALIGNMENT) unsigned char buffer[NB_COLUMNS][TILE_SIZE];
+        unsigned char* columns[NB_COLUMNS];
+        unsigned char* sources[NB_COLUMNS];
+        for (std::size_t column = 0; column < NB_COLUMNS; ++column) {
+            std::memcpy(buffer[column], columns_.data() + column * stride_ + first, length);
+            columns[column] = buffer[column];
+        }
+
+        for (std::size_t m = 0; m < nbMoves; ++m) {
+            const ColumnTurn_& turn = getColumnTurn(moves[m]);
+            std::memcpy(sources, columns, sizeof(columns));
+            for (std::size_t column = 0; column < NB_COLUMNS; ++column) {
+                columns[column] = sources[turn.sources[column]];
+            }
+            for (std::size_t column = CORNERS_ORIENTATION; column < EDGES_PERMUTATION; ++column) {
+                const unsigned char twist = turn.changes[column];
+                if (!twist) continue;
+                unsigned char* values = columns[column];
+                for (std::size_t i = 0; i < length; ++i) {
+                    const auto orientation = (unsigned char) (values[i] + twist);
+                    values[i] = orientation >= 3 ? (unsigned char) (orientation - 3) : orientation;
+                }
+            }
+            for (std::size_t column = EDGES_ORIENTATION; column < NB_COLUMNS; ++column) {
+                if (!turn.changes[column]) continue;
+                unsigned char* values = columns[column];
+                for (std::size_t i = 0; i < length; ++i) {
+                    values[i] ^= 1;
+                }
+            }
+        }
+
+        for (std::size_t column = 0; column < NB_COLUMNS; ++column) {
+            std::memcpy(columns_.data() + column * stride_ + first, columns[column], length);
+        }
+    }
+
+    std::size_t CubeBatch::nbTiles() const {
+        return (size_ + TILE_SIZE - 1) / TILE_SIZE;
+    }
+
+}
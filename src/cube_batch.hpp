@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "cube_state.hpp"
+#include "moves.hpp"
+#include "work_stealing_pool.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @class CubeBatch
+     * @brief Batch of cube states stored as columns, applying the same moves to all of them
+     * @details The batch holds one column per byte of CubeState_: the position of corner 0 in every state, then of
+     * corner 1, and so on, then the orientations and the edges. Sequences are applied tile by tile: the columns of a
+     * tile of TILE_SIZE states are copied to a buffer that fits the L1 cache, where every move of the sequence is
+     * applied before the tile is written back, so that the batch is streamed once per sequence. In the buffer, a move
+     * only renames the columns of the blocks it permutes, and changes the orientation columns it twists or flips by
+     * byte additions and exclusive ors, which are vectorized by the compiler.
+     */
+    class CubeBatch {
+    public:
+        /**
+         * @brief number of states whose columns are moved together
+         */
+        static const std::size_t TILE_SIZE = 512;
+
+        /**
+         * @brief creates a batch of sorted states
+         * @param size number of states
+         */
+        explicit CubeBatch(std::size_t size = 0);
+
+        /**
+         * @brief creates a batch holding copies of states
+         * @param states states reached by face turns, without mirrored corners (see CubeState_::multiply())
+         */
+        explicit CubeBatch(const std::vector<CubeState_>& states);
+
+        /**
+         * @brief returns the number of states of the batch
+         * @return number of states
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief gathers a state from the columns
+         * @param index index of the state
+         * @return copy of the state, the sorted state if the index is out of range
+         */
+        CubeState_ getState(std::size_t index) const;
+
+        /**
+         * @brief scatters a state into the columns
+         * @param index index of the state
+         * @param state state reached by face turns, without mirrored corners
+         */
+        void setState(std::size_t index, const CubeState_& state);
+
+        /**
+         * @brief counts the sorted states of the batch
+         * @return number of sorted states
+         */
+        std::size_t countSorted() const;
+
+        /**
+         * @brief applies a move to all the states
+         * @param move move to apply
+         */
+        void applyMove(const Move& move);
+
+        /**
+         * @brief applies a sequence of moves to all the states
+         * @param moves moves to apply, in order
+         */
+        void applySequence(const std::vector<Move>& moves);
+
+        /**
+         * @brief applies a sequence of moves to all the states, the tiles being split across the threads of a pool
+         * @param moves moves to apply, in order
+         * @param pool pool applying the moves
+         */
+        void applySequence(const std::vector<Move>& moves, WorkStealingPool& pool);
+
+    private:
+        std::size_t size_;
+        std::size_t stride_;                  /*!< distance between the columns, size_ rounded up to a cache line */
+        std::vector<unsigned char> columns_;  /*!< one column per byte of CubeState_, in the same order */
+
+        /**
+         * @brief applies moves to the states of a tile
+         * @param moves moves to apply, in order
+         * @param nbMoves number of moves
+         * @param tile index of the tile
+         */
+        void applyToTile(const Move* moves, std::size_t nbMoves, std::size_t tile);
+
+        /**
+         * @brief returns the number of tiles of the batch
+         */
+        std::size_t nbTiles() const;
+    };
+
+}
@@ -1,269 +1,378 @@
+#include <cstring>
 #include <iostream>
-#include <vector>
 
 #include "cube_state.hpp"
+#include "cubies.hpp"
+#include "face_turn_kernels.hpp"
+#include "stats.hpp"
 
 
 namespace rubiks {
 
-    CubeState_::CubeState_()
-            : facesCorners_(), facesEdges_() {
+    namespace {
+
+        const unsigned short NB_ROTATIONS = 3;
+        const unsigned short FIRST_EDGE_FACELET = 3 * CubeState_::TOTAL_CORNERS;
+        const unsigned short FIRST_CENTER_FACELET = FIRST_EDGE_FACELET + 2 * CubeState_::TOTAL_EDGES;
+
+        /**
+         * @brief rotation tables, indexed by the color of the rotating face then by the rotation direction
+         */
+        const FaceTurn_ FACE_TURNS[CubeState_::NB_FACES][NB_ROTATIONS] = {
+            // Color::RED
+            {
+                FaceTurn_{
+                    {1, 5, 2, 3, 0, 4, 6, 7},
+                    {1, 2, 0, 0, 2, 1, 0, 0},
+                    {0, 9, 2, 3, 4, 8, 6, 7, 1, 5, 10, 11},
+                    {0, 1, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0},
+                },
+                FaceTurn_{
+                    {4, 0, 2, 3, 5, 1, 6, 7},
+                    {1, 2, 0, 0, 2, 1, 0, 0},
+                    {0, 8, 2, 3, 4, 9, 6, 7, 5, 1, 10, 11},
+                    {0, 1, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0},
+                },
+                FaceTurn_{
+                    {5, 4, 2, 3, 1, 0, 6, 7},
+                    {0, 0, 0, 0, 0, 0, 0, 0},
+                    {0, 5, 2, 3, 4, 1, 6, 7, 9, 8, 10, 11},
+                    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+                },
+            },
+            // Color::GREEN
+            {
+                FaceTurn_{
+                    {0, 1, 2, 3, 5, 6, 7, 4},
+                    {0, 0, 0, 0, 0, 0, 0, 0},
+                    {0, 1, 2, 3, 5, 6, 7, 4, 8, 9, 10, 11},
+                    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+                },
+                FaceTurn_{
+                    {0, 1, 2, 3, 7, 4, 5, 6},
+                    {0, 0, 0, 0, 0, 0, 0, 0},
+                    {0, 1, 2, 3, 7, 4, 5, 6, 8, 9, 10, 11},
+                    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+                },
+                FaceTurn_{
+                    {0, 1, 2, 3, 6, 7, 4, 5},
+                    {0, 0, 0, 0, 0, 0, 0, 0},
+                    {0, 1, 2, 3, 6, 7, 4, 5, 8, 9, 10, 11},
+                    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+                },
+            },
+            // Color::BLUE
+            {
+                FaceTurn_{
+                    {3, 0, 1, 2, 4, 5, 6, 7},
+                    {0, 0, 0, 0, 0, 0, 0, 0},
+                    {3, 0, 1, 2, 4, 5, 6, 7, 8, 9, 10, 11},
+                    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+                },
+                FaceTurn_{
+                    {1, 2, 3, 0, 4, 5, 6, 7},
+                    {0, 0, 0, 0, 0, 0, 0, 0},
+                    {1, 2, 3, 0, 4, 5, 6, 7, 8, 9, 10, 11},
+                    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+                },
+                FaceTurn_{
+                    {2, 3, 0, 1, 4, 5, 6, 7},
+                    {0, 0, 0, 0, 0, 0, 0, 0},
+                    {2, 3, 0, 1, 4, 5, 6, 7, 8, 9, 10, 11},
+                    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+                },
+            },
+            // Color::YELLOW
+            {
+                FaceTurn_{
+                    {4, 1, 2, 0, 7, 5, 6, 3},
+                    {2, 0, 0, 1, 1, 0, 0, 2},
+                    {8, 1, 2, 3, 11, 5, 6, 7, 4, 9, 10, 0},
+                    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+                },
+                FaceTurn_{
+                    {3, 1, 2, 7, 0, 5, 6, 4},
+                    {2, 0, 0, 1, 1, 0, 0, 2},
+                    {11, 1, 2, 3, 8, 5, 6, 7, 0, 9, 10, 4},
+                    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+                },
+                FaceTurn_{
+                    {7, 1, 2, 4, 3, 5, 6, 0},
+                    {0, 0, 0, 0, 0, 0, 0, 0},
+                    {4, 1, 2, 3, 0, 5, 6, 7, 11, 9, 10, 8},
+                    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+                },
+            },
+            // Color::ORANGE
+            {
+                FaceTurn_{
+                    {0, 1, 3, 7, 4, 5, 2, 6},
+                    {0, 0, 1, 2, 0, 0, 2, 1},
+                    {0, 1, 2, 11, 4, 5, 6, 10, 8, 9, 3, 7},
+                    {0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 1},
+                },
+                FaceTurn_{
+                    {0, 1, 6, 2, 4, 5, 7, 3},
+                    {0, 0, 1, 2, 0, 0, 2, 1},
+                    {0, 1, 2, 10, 4, 5, 6, 11, 8, 9, 7, 3},
+                    {0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 1},
+                },
+                FaceTurn_{
+                    {0, 1, 7, 6, 4, 5, 3, 2},
+                    {0, 0, 0, 0, 0, 0, 0, 0},
+                    {0, 1, 2, 7, 4, 5, 6, 3, 8, 9, 11, 10},
+                    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+                },
+            },
+            // Color::WHITE
+            {
+                FaceTurn_{
+                    {0, 2, 6, 3, 4, 1, 5, 7},
+                    {0, 1, 2, 0, 0, 2, 1, 0},
+                    {0, 1, 10, 3, 4, 5, 9, 7, 8, 2, 6, 11},
+                    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+                },
+                FaceTurn_{
+                    {0, 5, 1, 3, 4, 6, 2, 7},
+                    {0, 1, 2, 0, 0, 2, 1, 0},
+                    {0, 1, 9, 3, 4, 5, 10, 7, 8, 6, 2, 11},
+                    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+                },
+                FaceTurn_{
+                    {0, 6, 5, 3, 4, 2, 1, 7},
+                    {0, 0, 0, 0, 0, 0, 0, 0},
+                    {0, 1, 6, 3, 4, 5, 2, 7, 8, 10, 9, 11},
+                    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+                },
+            },
+        };
+
+    }
+
+    CubeState_::CubeState_() {
         resetBlocks();
     }
 
     bool CubeState_::isSorted() const {
-        for (const Edge& edge: edges_) {
-            if (!edge.isWellPlaced()) return false;
+        // Single compare of the bytes of the blocks with a sorted state
+        static const CubeState_ sortedState;
+        return std::memcmp(this, &sortedState, sizeof(CubeState_)) == 0;
+    }
+
+    bool CubeState_::isSolvable() const {
+        unsigned short cornersSeen = 0, edgesSeen = 0, twist = 0, flip = 0;
+        for (unsigned short i = 0; i < TOTAL_CORNERS; ++i) {
+            if (cornersPermutation_[i] >= TOTAL_CORNERS || cornersOrientation_[i] >= 3) return false;
+            cornersSeen |= (unsigned short) (1 << cornersPermutation_[i]);
+            twist += cornersOrientation_[i];
+        }
+        for (unsigned short i = 0; i < TOTAL_EDGES; ++i) {
+            if (edgesPermutation_[i] >= TOTAL_EDGES || edgesOrientation_[i] >= 2) return false;
+            edgesSeen |= (unsigned short) (1 << edgesPermutation_[i]);
+            flip += edgesOrientation_[i];
+        }
+        if (cornersSeen != (1 << TOTAL_CORNERS) - 1 || edgesSeen != (1 << TOTAL_EDGES) - 1) return false;
+        if (twist % 3 || flip % 2) return false;
+
+        // Corners and edges permutations must have the same parity, given by their number of inversions
+        unsigned short inversions = 0;
+        for (unsigned short i = 0; i < TOTAL_CORNERS; ++i) {
+            for (unsigned short j = i + 1; j < TOTAL_CORNERS; ++j) {
+                if (cornersPermutation_[i] > cornersPermutation_[j]) ++inversions;
+            }
         }
-        for (const Corner& corner: corners_) {
-            if (!corner.isWellPlaced()) return false;
+        for (unsigned short i = 0; i < TOTAL_EDGES; ++i) {
+            for (unsigned short j = i + 1; j < TOTAL_EDGES; ++j) {
+                if (edgesPermutation_[i] > edgesPermutation_[j]) ++inversions;
+            }
         }
-        return true;
+        return inversions % 2 == 0;
     }
 
-    const EdgePtrArray_<CubeState_::EDGES_PER_FACE>& CubeState_::getFaceEdges(const Color &faceColor) const {
-        return facesEdges_.at(faceColor);
+    Color CubeState_::getEdgeColor(const Color &faceColor, const Color &adjacentColor) const {
+        const unsigned short facelet = getEdgeFacelet(faceColor, adjacentColor);
+        return facelet == NB_FACELETS ? Color::UNDEFINED : getFacelet(facelet);
     }
 
-    const CornerPtrArray_<CubeState_::CORNERS_PER_FACE>& CubeState_::getFaceCorners(const Color& faceColor) const {
-        return facesCorners_.at(faceColor);
+    Color CubeState_::getCornerColor(const Color &faceColor, const Color &adjacentColor1,
+                                     const Color &adjacentColor2) const {
+        const unsigned short facelet = getCornerFacelet(faceColor, adjacentColor1, adjacentColor2);
+        return facelet == NB_FACELETS ? Color::UNDEFINED : getFacelet(facelet);
     }
 
-    void CubeState_::resetBlocks() {
-        Color anyFrontColor = Color::RED;
-        Color anyTopColor = Color::BLUE;
-        Color backColor = ColorFinder::getOpposite(anyFrontColor);
-        Color bottomColor = ColorFinder::getOpposite(anyTopColor);
-        Color rightColor = ColorFinder::getFromFrontAndTop(anyFrontColor, anyTopColor, FacePose::RIGHT);
-        Color leftColor = ColorFinder::getOpposite(rightColor);
-
-        std::array<Color, NB_FACES - 2> lateralOrderedColors = {anyTopColor, rightColor, bottomColor, leftColor};
+    unsigned short CubeState_::getEdgeFacelet(const Color &faceColor, const Color &adjacentColor) {
+        if (faceColor == Color::UNDEFINED || adjacentColor == Color::UNDEFINED) return NB_FACELETS;
+        const unsigned char position = getEdgeId(getColorMask(faceColor) | getColorMask(adjacentColor));
+        if (position == NO_CUBIE) return NB_FACELETS;
 
-        std::map<Color, unsigned short> edge_ptr_counters = {
-                {anyFrontColor, 0},
-                {anyTopColor,   0},
-                {backColor,     0},
-                {bottomColor,   0},
-                {rightColor,    0},
-                {leftColor,     0},
-        };
-        std::map<Color, unsigned short> corner_ptr_counters(edge_ptr_counters);
-
-        // Initialize corners and front & back edges
-        unsigned short edgeCpt = 0;
-        unsigned short cornerCpt = 0;
-        for (const Color& frontalColor: {anyFrontColor, backColor}) {
-            for (unsigned short i = 0; i < NB_FACES - 2; ++i) {
-                const Color& adjacentColor1 = lateralOrderedColors[i];
-                const Color& adjacentColor2 = lateralOrderedColors[(i + 1) % (NB_FACES - 2)];
-                // Initialize edge colors
-                unsigned short& frontColorEdgeCnt = edge_ptr_counters[frontalColor];
-                unsigned short& adjacentColor1EdgeCnt = edge_ptr_counters[adjacentColor1];
-                initializeEdge(edgeCpt++, {frontalColor, adjacentColor1},
-                        {frontColorEdgeCnt++, adjacentColor1EdgeCnt++});
-                // Initialize corner colors
-                unsigned short& frontColorCornerCnt = corner_ptr_counters[frontalColor];
-                unsigned short& adjacentColor1CornerCnt = corner_ptr_counters[adjacentColor1];
-                unsigned short& adjacentColor2CornerCnt = corner_ptr_counters[adjacentColor2];
-                initializeCorner(cornerCpt++, {frontalColor, adjacentColor1, adjacentColor2},
-                        {frontColorCornerCnt++, adjacentColor1CornerCnt++, adjacentColor2CornerCnt++});
-            }
-        }
+        const unsigned short slot = EDGE_FACES[position][0] == faceColor ? 0 : 1;
+        return (unsigned short) (FIRST_EDGE_FACELET + 2 * position + slot);
+    }
 
-        // Initialize middle edges
-        for (unsigned short i = 0; i < NB_FACES - 2; ++i) {
-            const Color& adjacentColor1 = lateralOrderedColors[i];
-            const Color& adjacentColor2 = lateralOrderedColors[(i + 1) % (NB_FACES - 2)];
-            unsigned short& adjacentColor1EdgeCnt = edge_ptr_counters[adjacentColor1];
-            unsigned short& adjacentColor2EdgeCnt = edge_ptr_counters[adjacentColor2];
-            initializeEdge(edgeCpt++, {adjacentColor1, adjacentColor2},
-                    {adjacentColor1EdgeCnt++, adjacentColor2EdgeCnt++});
-        }
+    unsigned short CubeState_::getCornerFacelet(const Color &faceColor, const Color &adjacentColor1,
+                                                const Color &adjacentColor2) {
+        if (faceColor == Color::UNDEFINED || adjacentColor1 == Color::UNDEFINED || adjacentColor2 == Color::UNDEFINED)
+            return NB_FACELETS;
+        const unsigned char position = getCornerId(getColorMask(faceColor) | getColorMask(adjacentColor1)
+                                                         | getColorMask(adjacentColor2));
+        if (position == NO_CUBIE) return NB_FACELETS;
+
+        unsigned short slot = 0;
+        while (CORNER_FACES[position][slot] != faceColor) ++slot;
+        return (unsigned short) (3 * position + slot);
+    }
 
+    unsigned short CubeState_::getCenterFacelet(const Color &faceColor) {
+        if (faceColor == Color::UNDEFINED) return NB_FACELETS;
+        return (unsigned short) (FIRST_CENTER_FACELET + (unsigned short) faceColor);
     }
 
-    void CubeState_::initializeEdge(unsigned short blockIdx, std::array<Color, 2> &&colors,
-                                    std::array<unsigned short, 2>&& ptrIdxList) {
-        if (blockIdx >= edges_.size()) {
-            std::cerr << "[CubeState_] WARNING: Attempt to initialize edge at index " << blockIdx
-                      << "which is not in the CubeState_::edges_ boundaries [0, " << edges_.size() << "]"
-                      << std::endl << "[CubeState_] Ignoring edge initialization" << std::endl;
-            return;
+    Color CubeState_::getFacelet(unsigned short facelet) const {
+        if (facelet < FIRST_EDGE_FACELET) {
+            // The corner face displayed on the slot is shifted by the corner twist
+            const unsigned short position = facelet / 3, slot = facelet % 3;
+            return CORNER_FACES[cornersPermutation_[position]][(slot + 3 - cornersOrientation_[position]) % 3];
         }
+        if (facelet < FIRST_CENTER_FACELET) {
+            // The edge face displayed on the slot is shifted by the edge flip
+            const unsigned short position = (facelet - FIRST_EDGE_FACELET) / 2, slot = facelet & 1;
+            return EDGE_FACES[edgesPermutation_[position]][slot ^ edgesOrientation_[position]];
+        }
+        return (Color) (facelet - FIRST_CENTER_FACELET);
+    }
 
-        for (const std::size_t ptrIdx: ptrIdxList) {
-            if (ptrIdx >= facesEdges_.size()) {
-                std::cerr << "[CubeState_] WARNING: Attempt to initialize edge pointer at index " << ptrIdx
-                          << "which is not in CubeState_::facesEdges_ boundaries [0, " << facesEdges_.size() << "]"
-                          << std::endl << "[CubeState_] Ignoring edge pointer initialization" << std::endl;
-                return;
+    std::array<Color, CubeState_::NB_FACELETS> CubeState_::getFacelets() const {
+        std::array<Color, NB_FACELETS> facelets{};
+        for (unsigned short position = 0; position < TOTAL_CORNERS; ++position) {
+            const Color* faces = CORNER_FACES[cornersPermutation_[position]];
+            const unsigned char twist = cornersOrientation_[position];
+            for (unsigned short slot = 0; slot < 3; ++slot) {
+                facelets[3 * position + slot] = faces[(slot + 3 - twist) % 3];
             }
         }
-
-        if (std::find(colors.begin(), colors.end(), Color::UNDEFINED) != colors.end()) {
-            std::cerr << "[CubeState_] WARNING: Attempt to initialize an edge with the Color "
-                      << "\"Color::UNDEFINED\" which is not supported in CubeState_ colors."
-                      << std::endl << "[CubeState_] Ignoring edge pointer initialization" << std::endl;
-            return;
+        for (unsigned short position = 0; position < TOTAL_EDGES; ++position) {
+            const Color* faces = EDGE_FACES[edgesPermutation_[position]];
+            const unsigned char flip = edgesOrientation_[position];
+            facelets[FIRST_EDGE_FACELET + 2 * position] = faces[flip];
+            facelets[FIRST_EDGE_FACELET + 2 * position + 1] = faces[1 ^ flip];
         }
-
-        // Initialize edge colors
-        Edge* edgePtr = edges_.data() + blockIdx;
-        edgePtr->initColorsPlaces(std::forward<std::array<Color, 2>>(colors));
-
-        // Associate this edge pointer to both related cube faces (distinguished by their center color)
-        for (std::size_t i=0; i<2; ++i) {
-            facesEdges_[colors[i]][ptrIdxList[i]] = edges_.data() + blockIdx;
+        for (unsigned short face = 0; face < NB_FACES; ++face) {
+            facelets[FIRST_CENTER_FACELET + face] = (Color) face;
         }
+        return facelets;
     }
 
-    void CubeState_::initializeCorner(unsigned short blockIdx, std::array<Color, 3> &&colors,
-                                      std::array<unsigned short, 3>&& ptrIdxList) {
-        if (blockIdx >= corners_.size()) {
-            std::cerr << "[CubeState_] WARNING: Attempt to initialize corner at index " << blockIdx
-                      << "which is not in the CubeState_::corners_ boundaries [0, " << corners_.size() << "]"
-                      << std::endl << "[CubeState_] Ignoring corner initialization" << std::endl;
-            return;
+    void CubeState_::resetBlocks() {
+        for (unsigned char i = 0; i < TOTAL_CORNERS; ++i) {
+            cornersPermutation_[i] = i;
+            cornersOrientation_[i] = 0;
         }
-
-        for (const std::size_t ptrIdx: ptrIdxList) {
-            if (ptrIdx >= facesCorners_.size()) {
-                std::cerr << "[CubeState_] WARNING: Attempt to initialize corner pointer at index " << ptrIdx
-                          << "which is not in CubeState_::facesCorners_ boundaries [0, " << facesCorners_.size() << "]"
-                          << std::endl << "[CubeState_] Ignoring corner pointer initialization" << std::endl;
-                return;
-            }
+        for (unsigned char i = 0; i < TOTAL_EDGES; ++i) {
+            edgesPermutation_[i] = i;
+            edgesOrientation_[i] = 0;
         }
+    }
 
-        if (std::find(colors.begin(), colors.end(), Color::UNDEFINED) != colors.end()) {
-            std::cerr << "[CubeState_] WARNING: Attempt to initialize a corner with the Color "
-                      << "\"Color::UNDEFINED\" which is not supported in CubeState_ colors."
-                      << std::endl << "[CubeState_] Ignoring corner pointer initialization" << std::endl;
+    void CubeState_::rotateFace(const Color &faceColor, const Rotation& rotation) {
+        if (faceColor == Color::UNDEFINED) {
+            std::cerr << "[CubeState_] WARNING: Attempt to rotate a face of color "
+                      << "\"Color::UNDEFINED\" which is not a face color of CubeState_."
+                      << std::endl << "[CubeState_] Ignoring face rotation" << std::endl;
             return;
         }
-
-        // Initialize corner colors
-        Corner* cornerPtr = corners_.data() + blockIdx;
-        cornerPtr->initColorsPlaces(std::forward<std::array<Color, 3>>(colors));
-
-        // Associate this corner pointer to both related cube faces (distinguished by their center color)
-        for (std::size_t i=0; i<3; ++i) {
-            facesCorners_[colors[i]][ptrIdxList[i]] = corners_.data() + blockIdx;
-        }
+        countFaceTurns(faceColor);
+        getFaceTurnKernel(faceColor, rotation).apply(cornersPermutation_.data());
     }
 
-    void CubeState_::rotateFace(const Color &faceColor, const Rotation& rotation) {
+    void CubeState_::rotateFaces(CubeState_* states, std::size_t nbStates, const Color& faceColor,
+                                 const Rotation& rotation) {
         if (faceColor == Color::UNDEFINED) {
             std::cerr << "[CubeState_] WARNING: Attempt to rotate a face of color "
                       << "\"Color::UNDEFINED\" which is not a face color of CubeState_."
                       << std::endl << "[CubeState_] Ignoring face rotation" << std::endl;
             return;
         }
-        CornerPtrArray_<CORNERS_PER_FACE> cornersList = facesCorners_[faceColor];
-        EdgePtrArray_<EDGES_PER_FACE> edgesList = facesEdges_[faceColor];
-
-        // The relative positions to find successive colors changes according to the direction
-        FacePose nextFacePose = FacePose::RIGHT;
-        if (rotation == Rotation::ANTICLOCKWISE) nextFacePose = FacePose::LEFT;
-
-        // Get the four adjacent colors given this front color
-        Color topColor = ColorFinder::defaultTopColorFromFront(faceColor);
-        Color nextAdjacentColor = ColorFinder::getFromFrontAndTop(faceColor, topColor, nextFacePose);
-        Color bottomColor = ColorFinder::getOpposite(topColor);
-        Color lastAdjacentColor = ColorFinder::getOpposite(nextAdjacentColor);
-
-        // Maps to associate pointers with their previous and new faces
-        std::map<Color, Edge*> oldEdgeFace, newEdgeFace;
+        if (!nbStates) return;
+        countFaceTurns(faceColor, nbStates);
+        getFaceTurnKernel(faceColor, rotation).apply(states->cornersPermutation_.data(), nbStates, sizeof(CubeState_));
+    }
 
-        // Update edges faces colors locations
-        for (Edge* edgePtr: edgesList) {
-            for (const auto& edgeFace: edgePtr->blockColors()) {
-                // Edge face located on front face remains on front face
-                if (edgeFace.second != faceColor) {
-                    // Store old cube face of this edge face
-                    oldEdgeFace[edgeFace.second] = edgePtr;
-                    // Compute the new cube face of this edge face and update it
-                    Color newFaceColor = ColorFinder::getFromFrontAndTop(faceColor, edgeFace.second, nextFacePose);
-                    edgePtr->setColorPlace(edgeFace.first, newFaceColor);
-                    // Store this new cube face
-                    newEdgeFace[newFaceColor] = edgePtr;
+    const FaceTurnKernel_& CubeState_::getFaceTurnKernel(const Color& faceColor, const Rotation& rotation) {
+        // The kernels read the blocks as consecutive bytes
+        static_assert(sizeof(CubeState_) == FaceTurnKernel_::STATE_SIZE && std::is_standard_layout<CubeState_>::value,
+                      "CubeState_ must hold its blocks as consecutive bytes");
+        struct Kernels_ {
+            FaceTurnKernel_ kernels[NB_FACES][NB_ROTATIONS];
+
+            Kernels_() {
+                for (unsigned short face = 0; face < NB_FACES; ++face) {
+                    for (unsigned short rotation = 0; rotation < NB_ROTATIONS; ++rotation) {
+                        kernels[face][rotation] = FaceTurnKernel_(FACE_TURNS[face][rotation]);
+                    }
                 }
             }
-        }
+        };
+        static const Kernels_ kernels;
+        return kernels.kernels[(std::size_t) faceColor][(std::size_t) rotation];
+    }
 
-        // Update faces arrays of Edges*
-        for (const Color& adjacentFaceColor: {topColor, nextAdjacentColor, bottomColor, lastAdjacentColor}) {
-            // Get edges of an adjacent face
-            auto& faceEdges = facesEdges_[adjacentFaceColor];
-            // Get pointer of the edge that moved onto another cube face
-            Edge* edgeToReplace = oldEdgeFace[adjacentFaceColor];
-            auto edgePtrIt = std::find(faceEdges.begin(), faceEdges.end(), edgeToReplace);
-            if (edgePtrIt == faceEdges.end()) {
-                std::cerr << "[CubeState_] ERROR: Did not find edge with pointer " << edgeToReplace
-                          << " in array of Edge* of the cube face with color " << adjacentFaceColor << std::endl
-                          << "[CubeState_] Aborting rotation, cube structure correctness may be affected" << std::endl;
-                return;
+    void CubeState_::multiply(const CubeState_ &other) {
+        std::array<unsigned char, TOTAL_CORNERS> cornersPermutation{}, cornersOrientation{};
+        for (unsigned short i = 0; i < TOTAL_CORNERS; ++i) {
+            const unsigned char origin = other.cornersPermutation_[i];
+            const unsigned char orientation = cornersOrientation_[origin];
+            const unsigned char otherOrientation = other.cornersOrientation_[i];
+            // Orientations 3 to 5 are mirrored: a mirror reverses the direction of the following twists
+            short result;
+            if (orientation < 3 && otherOrientation < 3) {
+                result = (short) (orientation + otherOrientation);
+                if (result >= 3) result -= 3;
+            }
+            else if (orientation < 3) {
+                result = (short) (orientation + otherOrientation);
+                if (result >= 6) result -= 3;
             }
-            // This pointer becomes the one of the edge that just moved onto this cube face
-            *edgePtrIt = newEdgeFace[adjacentFaceColor];
+            else if (otherOrientation < 3) {
+                result = (short) (orientation - otherOrientation);
+                if (result < 3) result += 3;
+            }
+            else {
+                result = (short) (orientation - otherOrientation);
+                if (result < 0) result += 3;
+            }
+            cornersPermutation[i] = cornersPermutation_[origin];
+            cornersOrientation[i] = (unsigned char) result;
         }
 
-        // Maps to associate pointers with their previous and new faces
-        std::map<Color, std::vector<Corner*>> oldCornerFace, newCornerFace;
-
-        // Update corners faces colors locations
-        for (Corner* cornerPtr: cornersList) {
-            for (const auto& cornerFace: cornerPtr->blockColors()) {
-                HashColorArray cornerHash = cornerPtr->hashValue();
-                // Corner face located on front face remains on front face
-                if (cornerFace.second != faceColor) {
-                    // Store old cube face of this corner face as a potentially left face
-                    oldCornerFace[cornerFace.second].push_back(cornerPtr);
-                    // Compute the new cube face of this edge face and update it
-                    Color newFaceColor = ColorFinder::getFromFrontAndTop(faceColor, cornerFace.second, nextFacePose);
-                    cornerPtr->setColorPlace(cornerFace.first, newFaceColor);
-                    // This corner leaves `oldFaceColor` face only if its new cube face is opposite to the other
-                    // corner old face
-                    newCornerFace[newFaceColor].push_back(cornerPtr);
-                }
-            }
+        std::array<unsigned char, TOTAL_EDGES> edgesPermutation{}, edgesOrientation{};
+        for (unsigned short i = 0; i < TOTAL_EDGES; ++i) {
+            const unsigned char origin = other.edgesPermutation_[i];
+            edgesPermutation[i] = edgesPermutation_[origin];
+            edgesOrientation[i] = edgesOrientation_[origin] ^ other.edgesOrientation_[i];
         }
 
-        // Update faces arrays of Corner*
-        for (const Color &adjacentFaceColor: {topColor, nextAdjacentColor, bottomColor, lastAdjacentColor}) {
-            // Get moving corners for this adjacent face
-            std::vector<Corner*> &oldCorners = oldCornerFace[adjacentFaceColor];
-            std::vector<Corner*> &newCorners = newCornerFace[adjacentFaceColor];
-            // Search corners to replace for this face
-            Corner *leavingCorner=nullptr, *arrivingCorner=nullptr, *commonCorner=nullptr;
-            // The corner leaving the face is the one in oldCorners that is not in newCorners
-            for (Corner *oldCorner: oldCorners) {
-                if (std::find(newCorners.begin(), newCorners.end(), oldCorner) == newCorners.end()) {
-                    leavingCorner = oldCorner;
-                    break;
-                }
-                else commonCorner = oldCorner;
-            }
-            // The corner arriving in the face is the one in newCorners that is not in oldCorners
-            for (Corner *newCorner: newCorners) {
-                if (newCorner == commonCorner) continue;
-                if (std::find(oldCorners.begin(), oldCorners.end(), newCorner) == oldCorners.end()) {
-                    arrivingCorner = newCorner;
-                    break;
-                }
-            }
-            // Search leaving corner in this face corners list
-            auto &faceCorners = facesCorners_[adjacentFaceColor];
-            auto leavingCornerPtrIt = std::find(faceCorners.begin(), faceCorners.end(), leavingCorner);
-            if (leavingCornerPtrIt == faceCorners.end()) {
-                std::cerr << "[CubeState_] ERROR: Did not find corner with pointer " << leavingCorner
-                          << " in array of Corner* of the cube face with color " << adjacentFaceColor << std::endl
-                          << "[CubeState_] Aborting rotation, cube structure correctness may be affected" << std::endl;
-                return;
-            }
-            // This pointer becomes the arriving corner
-            *leavingCornerPtrIt = arrivingCorner;
+        cornersPermutation_ = cornersPermutation;
+        cornersOrientation_ = cornersOrientation;
+        edgesPermutation_ = edgesPermutation;
+        edgesOrientation_ = edgesOrientation;
+    }
+
+    CubeState_ CubeState_::getInverse() const {
+        CubeState_ inverse;
+        for (unsigned char i = 0; i < TOTAL_CORNERS; ++i) {
+            inverse.cornersPermutation_[cornersPermutation_[i]] = i;
+        }
+        for (unsigned short i = 0; i < TOTAL_CORNERS; ++i) {
+            const unsigned char orientation = cornersOrientation_[inverse.cornersPermutation_[i]];
+            inverse.cornersOrientation_[i] = orientation >= 3 ? orientation : (unsigned char) ((3 - orientation) % 3);
+        }
+        for (unsigned char i = 0; i < TOTAL_EDGES; ++i) {
+            inverse.edgesPermutation_[edgesPermutation_[i]] = i;
+        }
+        for (unsigned short i = 0; i < TOTAL_EDGES; ++i) {
+            inverse.edgesOrientation_[i] = edgesOrientation_[inverse.edgesPermutation_[i]];
         }
+        return inverse;
     }
 
-}
\ No newline at end of file
+}
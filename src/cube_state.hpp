@@ -1,5 +1,9 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
 #include "color_finder.hpp"
 #include "rotations.hpp"
 #include "types.hpp"
@@ -7,9 +11,16 @@
 
 namespace rubiks {
 
+    class FaceTurnKernel_;
+
     /**
      * @class CubeState_
      * @brief Encodes the state (configuration of all blocks) of a cube
+     * @details The state is stored at the block level: for each corner (resp. edge) position, the index of the
+     * corner (resp. edge) currently located there and its orientation. Positions and blocks share the same indexing,
+     * a block index being the index of the position it occupies when the cube is sorted. The whole state fits in
+     * 40 bytes and is trivially copyable; face rotations are applied from fixed permutation tables, as byte shuffles
+     * where the CPU supports them (see FaceTurnKernel_).
      */
     class CubeState_ {
 
@@ -20,10 +31,19 @@ namespace rubiks {
         static const unsigned short NB_FACES = ColorFinder::NB_FACES;
         static const unsigned short TOTAL_EDGES = 12;
         static const unsigned short TOTAL_CORNERS = 8;
+        static const unsigned short NB_FACELETS = 54;  /*!< number of colored block faces (facelets) of the cube */
 
         CubeState_();
         ~CubeState_() = default;
 
+        /**
+         * @brief copies are plain value copies: the state holds no pointer nor heap memory
+         */
+        CubeState_(const CubeState_&) = default;
+        CubeState_(CubeState_&&) = default;
+        CubeState_& operator=(const CubeState_&) = default;
+        CubeState_& operator=(CubeState_&&) = default;
+
         /**
          * @brief returns whether the cube is sorted (all blocks are the same color on each face) or not
          * @return True if the cube is sorted, False otherwise
@@ -31,18 +51,127 @@ namespace rubiks {
         bool isSorted() const;
 
         /**
-         * @brief retrieves the list of edges that are adjacent to a face
-         * @param faceColor color of the face (middle block)
-         * @return list of the adjacent edges
+         * @brief returns whether the state can be reached from a sorted cube by rotating faces
+         * @details The blocks must form valid permutations of equal parity, the sum of the corners orientations must
+         * be a multiple of 3 and the sum of the edges orientations must be even.
+         * @return True if the state is solvable, False otherwise
+         */
+        bool isSolvable() const;
+
+        /**
+         * @brief retrieves the corner located at a corner position
+         * @param position index of the corner position (0-7)
+         * @return index of the corner (0-7)
+         */
+        unsigned char getCorner(unsigned short position) const {
+            return cornersPermutation_[position];
+        }
+
+        /**
+         * @brief retrieves the orientation of the corner located at a corner position
+         * @param position index of the corner position (0-7)
+         * @return clockwise twist of the corner (0-2), 0 when its BLUE or GREEN face is on the BLUE or GREEN face
+         */
+        unsigned char getCornerOrientation(unsigned short position) const {
+            return cornersOrientation_[position];
+        }
+
+        /**
+         * @brief retrieves the edge located at an edge position
+         * @param position index of the edge position (0-11)
+         * @return index of the edge (0-11)
          */
-        const EdgePtrArray_<EDGES_PER_FACE>& getFaceEdges(const Color& faceColor) const;
+        unsigned char getEdge(unsigned short position) const {
+            return edgesPermutation_[position];
+        }
 
         /**
-         * @brief retrieves the list of corners that are adjacent to a face
+         * @brief retrieves the orientation of the edge located at an edge position
+         * @param position index of the edge position (0-11)
+         * @return flip of the edge (0-1), 0 when its reference face is on the reference face of the position
+         */
+        unsigned char getEdgeOrientation(unsigned short position) const {
+            return edgesOrientation_[position];
+        }
+
+        /**
+         * @brief places a corner at a corner position, without checking the consistency of the resulting state
+         * @param position index of the corner position (0-7)
+         * @param corner index of the corner (0-7)
+         * @param orientation clockwise twist of the corner (0-2)
+         */
+        void setCorner(unsigned short position, unsigned char corner, unsigned char orientation) {
+            cornersPermutation_[position] = corner;
+            cornersOrientation_[position] = orientation;
+        }
+
+        /**
+         * @brief places an edge at an edge position, without checking the consistency of the resulting state
+         * @param position index of the edge position (0-11)
+         * @param edge index of the edge (0-11)
+         * @param orientation flip of the edge (0-1)
+         */
+        void setEdge(unsigned short position, unsigned char edge, unsigned char orientation) {
+            edgesPermutation_[position] = edge;
+            edgesOrientation_[position] = orientation;
+        }
+
+        /**
+         * @brief retrieves the color displayed on a face by the edge shared with an adjacent face
+         * @param faceColor color of the face (middle block) on which the color is displayed
+         * @param adjacentColor color of the adjacent face (middle block) sharing the edge
+         * @return color of the edge on the face, Color::UNDEFINED if the faces are not adjacent
+         */
+        Color getEdgeColor(const Color& faceColor, const Color& adjacentColor) const;
+
+        /**
+         * @brief retrieves the color displayed on a face by the corner shared with two adjacent faces
+         * @param faceColor color of the face (middle block) on which the color is displayed
+         * @param adjacentColor1 color of the first adjacent face (middle block) sharing the corner
+         * @param adjacentColor2 color of the second adjacent face (middle block) sharing the corner
+         * @return color of the corner on the face, Color::UNDEFINED if the faces do not share a corner
+         */
+        Color getCornerColor(const Color& faceColor, const Color& adjacentColor1, const Color& adjacentColor2) const;
+
+        /**
+         * @brief identifies the facelet displayed on a face by the edge shared with an adjacent face
+         * @details Facelets are numbered by corner position and slot (0-23), then by edge position and slot (24-47),
+         * then by middle block color (48-53).
+         * @param faceColor color of the face (middle block) on which the facelet is displayed
+         * @param adjacentColor color of the adjacent face (middle block) sharing the edge
+         * @return index of the facelet, NB_FACELETS if the faces are not adjacent
+         */
+        static unsigned short getEdgeFacelet(const Color& faceColor, const Color& adjacentColor);
+
+        /**
+         * @brief identifies the facelet displayed on a face by the corner shared with two adjacent faces
+         * @param faceColor color of the face (middle block) on which the facelet is displayed
+         * @param adjacentColor1 color of the first adjacent face (middle block) sharing the corner
+         * @param adjacentColor2 color of the second adjacent face (middle block) sharing the corner
+         * @return index of the facelet, NB_FACELETS if the faces do not share a corner
+         */
+        static unsigned short getCornerFacelet(const Color& faceColor, const Color& adjacentColor1,
+                                               const Color& adjacentColor2);
+
+        /**
+         * @brief identifies the facelet of the middle block of a face
          * @param faceColor color of the face (middle block)
-         * @return list of the adjacent corners
+         * @return index of the facelet, NB_FACELETS if the color is not a face color
          */
-        const CornerPtrArray_<CORNERS_PER_FACE>& getFaceCorners(const Color& faceColor) const;
+        static unsigned short getCenterFacelet(const Color& faceColor);
+
+        /**
+         * @brief retrieves the color of a facelet
+         * @param facelet index of the facelet (see getEdgeFacelet())
+         * @return color of the facelet
+         */
+        Color getFacelet(unsigned short facelet) const;
+
+        /**
+         * @brief retrieves the colors of all the facelets, without any allocation
+         * @return color of each facelet, indexed as by getEdgeFacelet()
+         */
+        std::array<Color, NB_FACELETS> getFacelets() const;
 
         /**
          * @brief Resets the cube to a sorted state
@@ -56,18 +185,45 @@ namespace rubiks {
          */
         void rotateFace(const Color& color, const Rotation& rotation);
 
-    private:
-        EnumArray_<Color, CornerPtrArray_<CORNERS_PER_FACE>, NB_FACES> facesCorners_;
-        EnumArray_<Color, EdgePtrArray_<EDGES_PER_FACE>, NB_FACES> facesEdges_;
-        std::array<Edge, TOTAL_EDGES> edges_;
-        std::array<Corner, TOTAL_CORNERS> corners_;
+        /**
+         * @brief rotates the same face of several states in the same direction
+         * @details With AVX2, two states are turned per instruction, which suits bulk scrambles and searches.
+         * @param states states to rotate
+         * @param nbStates number of states
+         * @param color color of the face to rotate (designates the color of the middle block)
+         * @param rotation rotation direction
+         */
+        static void rotateFaces(CubeState_* states, std::size_t nbStates, const Color& color, const Rotation& rotation);
+
+        /**
+         * @brief composes the state with another one, applied after it
+         * @details Each position receives the block located at the position given by the other state permutation, its
+         * orientation being increased by the other state orientation. Corner orientations 3 to 5 denote mirrored
+         * corners, which only appear in the reflections of the cube (see getSymmetry()).
+         * @param other state applied after this one, as a sequence of moves
+         */
+        void multiply(const CubeState_& other);
 
-        void initializeEdge(unsigned short blockIdx, std::array<Color, 2>&& colors,
-                            std::array<unsigned short, 2>&& ptrIdxList);
+        /**
+         * @brief computes the state cancelling this one
+         * @return state whose composition with this one is the sorted state
+         */
+        CubeState_ getInverse() const;
 
-        void initializeCorner(unsigned short blockIdx, std::array<Color, 3>&& colors,
-                              std::array<unsigned short, 3>&& ptrIdxList);
+    private:
+        std::array<unsigned char, TOTAL_CORNERS> cornersPermutation_;  /*!< corner located at each corner position */
+        std::array<unsigned char, TOTAL_CORNERS> cornersOrientation_;  /*!< clockwise twist (0-2) of each corner */
+        std::array<unsigned char, TOTAL_EDGES> edgesPermutation_;      /*!< edge located at each edge position */
+        std::array<unsigned char, TOTAL_EDGES> edgesOrientation_;      /*!< flip (0-1) of each edge */
+
+        /**
+         * @brief retrieves the kernel applying a face rotation, building the kernels on the first call
+         */
+        static const FaceTurnKernel_& getFaceTurnKernel(const Color& faceColor, const Rotation& rotation);
 
     };
 
-}
\ No newline at end of file
+    static_assert(std::is_trivially_copyable<CubeState_>::value,
+                  "CubeState_ must remain trivially copyable to be cheaply snapshotted");
+
+}
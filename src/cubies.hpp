@@ -0,0 +1,102 @@
+#pragma once
+
+#include "colors.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @brief Numbers of corner and edge blocks (cubies) of a cube
+     */
+    const unsigned short NB_CORNER_CUBIES = 8;
+    const unsigned short NB_EDGE_CUBIES = 12;
+
+    /**
+     * @brief Identifier returned for colors that do not form a block
+     */
+    const unsigned char NO_CUBIE = 0xFF;
+
+    /**
+     * @brief colors of the faces of each corner position, in clockwise order starting from the BLUE or GREEN face
+     * @details Positions are laid out with the BLUE face on top, the RED face in front and the YELLOW face on
+     * the right, as defined by ColorFinder. A corner is identified by the index of the position it occupies when the
+     * cube is sorted.
+     */
+    constexpr Color CORNER_FACES[NB_CORNER_CUBIES][3] = {
+            {Color::BLUE,  Color::YELLOW, Color::RED},
+            {Color::BLUE,  Color::RED,    Color::WHITE},
+            {Color::BLUE,  Color::WHITE,  Color::ORANGE},
+            {Color::BLUE,  Color::ORANGE, Color::YELLOW},
+            {Color::GREEN, Color::RED,    Color::YELLOW},
+            {Color::GREEN, Color::WHITE,  Color::RED},
+            {Color::GREEN, Color::ORANGE, Color::WHITE},
+            {Color::GREEN, Color::YELLOW, Color::ORANGE},
+    };
+
+    /**
+     * @brief colors of the faces of each edge position, the reference face (orientation 0) first
+     * @details An edge is identified by the index of the position it occupies when the cube is sorted.
+     */
+    constexpr Color EDGE_FACES[NB_EDGE_CUBIES][2] = {
+            {Color::BLUE,   Color::YELLOW},
+            {Color::BLUE,   Color::RED},
+            {Color::BLUE,   Color::WHITE},
+            {Color::BLUE,   Color::ORANGE},
+            {Color::GREEN,  Color::YELLOW},
+            {Color::GREEN,  Color::RED},
+            {Color::GREEN,  Color::WHITE},
+            {Color::GREEN,  Color::ORANGE},
+            {Color::RED,    Color::YELLOW},
+            {Color::RED,    Color::WHITE},
+            {Color::ORANGE, Color::WHITE},
+            {Color::ORANGE, Color::YELLOW},
+    };
+
+    /**
+     * @brief Identifiers of the blocks, indexed by the bitmask of the colors of their faces
+     */
+    struct CubieLookup_ {
+        unsigned char corners[1 << NB_COLORS];
+        unsigned char edges[1 << NB_COLORS];
+    };
+
+    constexpr CubieLookup_ buildCubieLookup() {
+        CubieLookup_ lookup{};
+        for (unsigned short mask = 0; mask < (1 << NB_COLORS); ++mask) {
+            lookup.corners[mask] = NO_CUBIE;
+            lookup.edges[mask] = NO_CUBIE;
+        }
+        for (unsigned short i = 0; i < NB_CORNER_CUBIES; ++i) {
+            lookup.corners[getColorMask(CORNER_FACES[i][0]) | getColorMask(CORNER_FACES[i][1])
+                           | getColorMask(CORNER_FACES[i][2])] = (unsigned char) i;
+        }
+        for (unsigned short i = 0; i < NB_EDGE_CUBIES; ++i) {
+            lookup.edges[getColorMask(EDGE_FACES[i][0]) | getColorMask(EDGE_FACES[i][1])] = (unsigned char) i;
+        }
+        return lookup;
+    }
+
+    constexpr CubieLookup_ CUBIE_LOOKUP = buildCubieLookup();
+
+    /**
+     * @brief Identifies a corner by its colors.
+     * @param colors bitmask of the colors of the corner faces (see getColorMask())
+     * @return index of the corner (0-7), NO_CUBIE if the colors do not form a corner
+     */
+    constexpr unsigned char getCornerId(ColorMask colors) {
+        return colors < (1 << NB_COLORS) ? CUBIE_LOOKUP.corners[colors] : NO_CUBIE;
+    }
+
+    /**
+     * @brief Identifies an edge by its colors.
+     * @param colors bitmask of the colors of the edge faces (see getColorMask())
+     * @return index of the edge (0-11), NO_CUBIE if the colors do not form an edge
+     */
+    constexpr unsigned char getEdgeId(ColorMask colors) {
+        return colors < (1 << NB_COLORS) ? CUBIE_LOOKUP.edges[colors] : NO_CUBIE;
+    }
+
+    static_assert(getCornerId(getColorMask(Color::BLUE) | getColorMask(Color::RED) | getColorMask(Color::YELLOW)) == 0,
+                  "corner ids must be computable at compile time");
+
+}
@@ -0,0 +1,129 @@
+#include <algorithm>
+
+#include "cube_state.hpp"
+#include "enumeration.hpp"
+#include "moves.hpp"
+#include "symmetries.hpp"
+
+
+namespace rubiks {
+
+    namespace {
+
+        const std::size_t CHUNK_SIZE = 4096;  /*!< number of states expanded by a task */
+
+        /**
+         * @brief State packed on two words, 5 bits per corner (block and orientation) and per edge
+         */
+        struct PackedState_ {
+            std::uint64_t corners;
+            std::uint64_t edges;
+
+            bool operator<(const PackedState_& other) const {
+                return corners != other.corners ? corners < other.corners : edges < other.edges;
+            }
+
+            bool operator==(const PackedState_& other) const {
+                return corners == other.corners && edges == other.edges;
+            }
+        };
+
+        PackedState_ pack(const CubeState_& state) {
+            PackedState_ packed{0, 0};
+            for (unsigned short i = 0; i < CubeState_::TOTAL_CORNERS; ++i) {
+                packed.corners = packed.corners << 5 | state.getCorner(i) << 2 | state.getCornerOrientation(i);
+            }
+            for (unsigned short i = 0; i < CubeState_::TOTAL_EDGES; ++i) {
+                packed.edges = packed.edges << 5 | state.getEdge(i) << 1 | state.getEdgeOrientation(i);
+            }
+            return packed;
+        }
+
+        CubeState_ unpack(PackedState_ packed) {
+            CubeState_ state;
+            for (unsigned short i = CubeState_::TOTAL_CORNERS; i-- > 0; packed.corners >>= 5) {
+                state.setCorner(i, (unsigned char) (packed.corners >> 2 & 0x7), (unsigned char) (packed.corners & 0x3));
+            }
+            for (unsigned short i = CubeState_::TOTAL_EDGES; i-- > 0; packed.edges >>= 5) {
+                state.setEdge(i, (unsigned char) (packed.edges >> 1 & 0xF), (unsigned char) (packed.edges & 0x1));
+            }
+            return state;
+        }
+
+        /**
+         * @brief Returns the number of states of the class of a canonical state, as its number of distinct conjugates
+         */
+        std::uint64_t getClassSize(const CubeState_& canonical) {
+            const PackedState_ packed = pack(canonical);
+            unsigned short nbSelfSymmetries = 0;
+            for (unsigned short symmetry = 0; symmetry < NB_SYMMETRIES; ++symmetry) {
+                if (pack(conjugate(canonical, symmetry)) == packed) ++nbSelfSymmetries;
+            }
+            return NB_SYMMETRIES / nbSelfSymmetries;
+        }
+
+        bool contains(const std::vector<PackedState_>& level, const PackedState_& state) {
+            return std::binary_search(level.begin(), level.end(), state);
+        }
+
+    }
+
+    EnumerationResult enumerateDistances(unsigned short maxDepth, WorkStealingPool& pool, bool useSymmetries) {
+        EnumerationResult result;
+        std::vector<PackedState_> previous;
+        std::vector<PackedState_> current(1, pack(CubeState_()));
+        std::vector<PackedState_> next;
+        result.nbStates.push_back(1);
+        result.nbClasses = 1;
+
+        for (unsigned short depth = 0; depth < maxDepth; ++depth) {
+            // Each chunk of the current level gives its sorted new states, which are then merged
+            const std::size_t nbChunks = (current.size() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+            std::vector<std::vector<PackedState_>> chunks(nbChunks);
+            pool.parallelFor(nbChunks, [&](std::size_t chunk) {
+                std::vector<PackedState_>& chunkStates = chunks[chunk];
+                const std::size_t end = std::min(current.size(), (chunk + 1) * CHUNK_SIZE);
+                for (std::size_t i = chunk * CHUNK_SIZE; i < end; ++i) {
+                    const CubeState_ state = unpack(current[i]);
+                    for (unsigned short move = 0; move < NB_MOVES; ++move) {
+                        const Move& faceMove = getMove(move);
+                        CubeState_ neighbour(state);
+                        neighbour.rotateFace(faceMove.faceColor, faceMove.rotation);
+                        const PackedState_ packed =
+                                pack(useSymmetries ? getCanonicalState(neighbour, false).state : neighbour);
+                        if (!contains(current, packed) && !contains(previous, packed)) chunkStates.push_back(packed);
+                    }
+                }
+                std::sort(chunkStates.begin(), chunkStates.end());
+                chunkStates.erase(std::unique(chunkStates.begin(), chunkStates.end()), chunkStates.end());
+            });
+
+            next.clear();
+            for (std::vector<PackedState_>& chunk: chunks) {
+                next.insert(next.end(), chunk.begin(), chunk.end());
+                std::vector<PackedState_>().swap(chunk);
+            }
+            std::sort(next.begin(), next.end());
+            next.erase(std::unique(next.begin(), next.end()), next.end());
+            result.nbMoves += current.size() * NB_MOVES;
+            result.nbClasses += next.size();
+
+            std::uint64_t nbStates = next.size();
+            if (useSymmetries) {
+                std::vector<std::uint64_t> classSizes(next.size());
+                pool.parallelFor(next.size(), [&](std::size_t i) {
+                    classSizes[i] = getClassSize(unpack(next[i]));
+                });
+                nbStates = 0;
+                for (std::uint64_t classSize: classSizes) nbStates += classSize;
+            }
+            result.nbStates.push_back(nbStates);
+
+            // Double buffering: the current level becomes the previous one, whose storage receives the next level
+            previous.swap(current);
+            current.swap(next);
+        }
+        return result;
+    }
+
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "work_stealing_pool.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @struct EnumerationResult
+     * @brief Number of states at each distance from the sorted state, in face turns
+     */
+    struct EnumerationResult {
+        std::vector<std::uint64_t> nbStates;  /*!< number of states at each distance, from 0 to the maximum depth */
+        std::uint64_t nbClasses = 0;          /*!< number of stored states, symmetry classes if they were reduced */
+        std::uint64_t nbMoves = 0;            /*!< number of face turns applied during the enumeration */
+    };
+
+    /**
+     * @brief Enumerates all the states within a number of face turns of the sorted state, on the threads of a pool.
+     * @details The search goes breadth first, level by level: each state of the current level is expanded by the 18
+     * moves, and the states that are neither in the previous level nor in the current one make the next level, since a
+     * move changes the distance by at most one. Levels are stored as sorted arrays of states packed on 16 bytes. When
+     * symmetries are used, only the canonical representative of each class under the 48 symmetries is stored (see
+     * getCanonicalState()), and the states of a class are counted from the number of its distinct conjugates, so that
+     * the counts are the same either way. The largest levels grow about 13 times per move: depth 7 (about 10^8
+     * states) needs a few gigabytes, or 48 times less with symmetries.
+     * @param maxDepth maximum distance of the enumerated states
+     * @param pool pool expanding the states
+     * @param useSymmetries whether to store one state per symmetry class, trading time for memory
+     * @return number of states at each distance, known as 1, 18, 243, 3240, 43239, 574908, 7618438, ...
+     */
+    EnumerationResult enumerateDistances(unsigned short maxDepth, WorkStealingPool& pool, bool useSymmetries = false);
+
+}
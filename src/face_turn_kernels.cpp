@@ -0,0 +1,208 @@
+#include "face_turn_kernels.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RUBIKS_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+
+namespace rubiks {
+
+    namespace {
+
+        const unsigned char ZERO_LANE = 0x80;  /*!< shuffle index giving a zero byte */
+        const std::size_t EDGES_OFFSET = 2 * CubeState_::TOTAL_CORNERS;  /*!< offset of the edges in a state */
+        const std::size_t HIGH_OFFSET = EDGES_OFFSET + 8;                /*!< offset of the high edges vector */
+
+    }
+
+    FaceTurnKernel_::FaceTurnKernel_(const FaceTurn_& turn)
+            : turn_(turn) {
+        const unsigned short nbCorners = CubeState_::TOTAL_CORNERS, nbEdges = CubeState_::TOTAL_EDGES;
+        for (unsigned short i = 0; i < nbCorners; ++i) {
+            cornersShuffle_[i] = turn.cornersPermutation[i];
+            cornersShuffle_[nbCorners + i] = (unsigned char) (nbCorners + turn.cornersPermutation[i]);
+            cornersTwist_[i] = 0;
+            cornersTwist_[nbCorners + i] = turn.cornersOrientation[i];
+            cornersModulo_[i] = 0;
+            cornersModulo_[nbCorners + i] = 3;
+        }
+
+        // The orientation of edge j is byte 12 + j of the edges, that is lane 4 + j of the high vector
+        for (unsigned short lane = 0; lane < 16; ++lane) {
+            const bool lowIsPermutation = lane < nbEdges;
+            const unsigned short lowOrientation = lane - nbEdges;
+            lowFromLow_[lane] = lowIsPermutation ? turn.edgesPermutation[lane] : ZERO_LANE;
+            lowFromHigh_[lane] = lowIsPermutation ? ZERO_LANE
+                                                  : (unsigned char) (4 + turn.edgesPermutation[lowOrientation]);
+            lowFlip_[lane] = lowIsPermutation ? 0 : turn.edgesOrientation[lowOrientation];
+
+            const bool highIsPermutation = lane < 4;
+            const unsigned short highOrientation = lane - 4;
+            highFromLow_[lane] = highIsPermutation ? turn.edgesPermutation[8 + lane] : ZERO_LANE;
+            highFromHigh_[lane] = highIsPermutation ? ZERO_LANE
+                                                    : (unsigned char) (4 + turn.edgesPermutation[highOrientation]);
+            highFlip_[lane] = highIsPermutation ? 0 : turn.edgesOrientation[highOrientation];
+        }
+    }
+
+    void FaceTurnKernel_::apply(unsigned char* state) const {
+        static const Implementation_ implementation = getSelectedImplementation();
+        // A single state does not benefit from the 256-bit registers
+        (implementation == &applyScalar ? applyScalar : applySsse3)(*this, state, 1, STATE_SIZE);
+    }
+
+    void FaceTurnKernel_::apply(unsigned char* states, std::size_t nbStates, std::size_t stride) const {
+        static const Implementation_ implementation = getSelectedImplementation();
+        implementation(*this, states, nbStates, stride);
+    }
+
+    const char* FaceTurnKernel_::getImplementation() {
+        const Implementation_ implementation = getSelectedImplementation();
+        if (implementation == &applyScalar) return "scalar";
+        return implementation == &applySsse3 ? "ssse3" : "avx2";
+    }
+
+    FaceTurnKernel_::Implementation_ FaceTurnKernel_::getSelectedImplementation() {
+#ifdef RUBIKS_X86_KERNELS
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return &applyAvx2;
+        if (__builtin_cpu_supports("ssse3")) return &applySsse3;
+#endif
+        return &applyScalar;
+    }
+
+    void FaceTurnKernel_::applyScalar(const FaceTurnKernel_& kernel, unsigned char* states, std::size_t nbStates,
+                                      std::size_t stride) {
+        const FaceTurn_& turn = kernel.turn_;
+        const unsigned short nbCorners = CubeState_::TOTAL_CORNERS, nbEdges = CubeState_::TOTAL_EDGES;
+        for (std::size_t n = 0; n < nbStates; ++n) {
+            unsigned char* state = states + n * stride;
+            unsigned char result[STATE_SIZE];
+
+            // Each position receives the block located at the position given by the rotation table
+            for (unsigned short i = 0; i < nbCorners; ++i) {
+                const unsigned char origin = turn.cornersPermutation[i];
+                auto orientation = (unsigned char) (state[nbCorners + origin] + turn.cornersOrientation[i]);
+                if (orientation >= 3) orientation -= 3;
+                result[i] = state[origin];
+                result[nbCorners + i] = orientation;
+            }
+            unsigned char* edges = state + EDGES_OFFSET;
+            for (unsigned short i = 0; i < nbEdges; ++i) {
+                const unsigned char origin = turn.edgesPermutation[i];
+                result[EDGES_OFFSET + i] = edges[origin];
+                result[EDGES_OFFSET + nbEdges + i] = edges[nbEdges + origin] ^ turn.edgesOrientation[i];
+            }
+            for (std::size_t i = 0; i < STATE_SIZE; ++i) state[i] = result[i];
+        }
+    }
+
+#ifdef RUBIKS_X86_KERNELS
+
+    namespace {
+
+        __attribute__((target("ssse3")))
+        __m128i loadVector(const unsigned char* bytes) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+        }
+
+        __attribute__((target("avx2")))
+        __m256i loadVectors(const unsigned char* first, const unsigned char* second) {
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(loadVector(first)), loadVector(second), 1);
+        }
+
+        __attribute__((target("avx2")))
+        void storeVectors(unsigned char* first, unsigned char* second, __m256i vectors) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(first), _mm256_castsi256_si128(vectors));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(second), _mm256_extracti128_si256(vectors, 1));
+        }
+
+    }
+
+    __attribute__((target("ssse3")))
+    void FaceTurnKernel_::applySsse3(const FaceTurnKernel_& kernel, unsigned char* states, std::size_t nbStates,
+                                     std::size_t stride) {
+        const __m128i cornersShuffle = loadVector(kernel.cornersShuffle_);
+        const __m128i cornersTwist = loadVector(kernel.cornersTwist_);
+        const __m128i cornersModulo = loadVector(kernel.cornersModulo_);
+        const __m128i lowFromLow = loadVector(kernel.lowFromLow_);
+        const __m128i lowFromHigh = loadVector(kernel.lowFromHigh_);
+        const __m128i lowFlip = loadVector(kernel.lowFlip_);
+        const __m128i highFromLow = loadVector(kernel.highFromLow_);
+        const __m128i highFromHigh = loadVector(kernel.highFromHigh_);
+        const __m128i highFlip = loadVector(kernel.highFlip_);
+
+        for (std::size_t n = 0; n < nbStates; ++n) {
+            unsigned char* state = states + n * stride;
+            const __m128i low = loadVector(state + EDGES_OFFSET);
+            const __m128i high = loadVector(state + HIGH_OFFSET);
+
+            // Twists of 3 or 4 are brought back below 3, the unsigned minimum keeping the others
+            __m128i corners = _mm_add_epi8(_mm_shuffle_epi8(loadVector(state), cornersShuffle), cornersTwist);
+            corners = _mm_min_epu8(corners, _mm_sub_epi8(corners, cornersModulo));
+            const __m128i newLow = _mm_xor_si128(
+                    _mm_or_si128(_mm_shuffle_epi8(low, lowFromLow), _mm_shuffle_epi8(high, lowFromHigh)), lowFlip);
+            const __m128i newHigh = _mm_xor_si128(
+                    _mm_or_si128(_mm_shuffle_epi8(low, highFromLow), _mm_shuffle_epi8(high, highFromHigh)), highFlip);
+
+            // The two edges vectors overlap on bytes which they both hold the result of
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(state), corners);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(state + EDGES_OFFSET), newLow);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(state + HIGH_OFFSET), newHigh);
+        }
+    }
+
+    __attribute__((target("avx2")))
+    void FaceTurnKernel_::applyAvx2(const FaceTurnKernel_& kernel, unsigned char* states, std::size_t nbStates,
+                                    std::size_t stride) {
+        const __m256i cornersShuffle = _mm256_broadcastsi128_si256(loadVector(kernel.cornersShuffle_));
+        const __m256i cornersTwist = _mm256_broadcastsi128_si256(loadVector(kernel.cornersTwist_));
+        const __m256i cornersModulo = _mm256_broadcastsi128_si256(loadVector(kernel.cornersModulo_));
+        const __m256i lowFromLow = _mm256_broadcastsi128_si256(loadVector(kernel.lowFromLow_));
+        const __m256i lowFromHigh = _mm256_broadcastsi128_si256(loadVector(kernel.lowFromHigh_));
+        const __m256i lowFlip = _mm256_broadcastsi128_si256(loadVector(kernel.lowFlip_));
+        const __m256i highFromLow = _mm256_broadcastsi128_si256(loadVector(kernel.highFromLow_));
+        const __m256i highFromHigh = _mm256_broadcastsi128_si256(loadVector(kernel.highFromHigh_));
+        const __m256i highFlip = _mm256_broadcastsi128_si256(loadVector(kernel.highFlip_));
+
+        // Each 128-bit lane holds a state, the byte shuffles staying within their lane
+        std::size_t n = 0;
+        for (; n + 2 <= nbStates; n += 2) {
+            unsigned char* first = states + n * stride;
+            unsigned char* second = first + stride;
+            const __m256i low = loadVectors(first + EDGES_OFFSET, second + EDGES_OFFSET);
+            const __m256i high = loadVectors(first + HIGH_OFFSET, second + HIGH_OFFSET);
+
+            __m256i corners = _mm256_add_epi8(_mm256_shuffle_epi8(loadVectors(first, second), cornersShuffle),
+                                              cornersTwist);
+            corners = _mm256_min_epu8(corners, _mm256_sub_epi8(corners, cornersModulo));
+            const __m256i newLow = _mm256_xor_si256(
+                    _mm256_or_si256(_mm256_shuffle_epi8(low, lowFromLow), _mm256_shuffle_epi8(high, lowFromHigh)),
+                    lowFlip);
+            const __m256i newHigh = _mm256_xor_si256(
+                    _mm256_or_si256(_mm256_shuffle_epi8(low, highFromLow), _mm256_shuffle_epi8(high, highFromHigh)),
+                    highFlip);
+
+            storeVectors(first, second, corners);
+            storeVectors(first + EDGES_OFFSET, second + EDGES_OFFSET, newLow);
+            storeVectors(first + HIGH_OFFSET, second + HIGH_OFFSET, newHigh);
+        }
+        if (n < nbStates) applySsse3(kernel, states + n * stride, nbStates - n, stride);
+    }
+
+#else
+
+    void FaceTurnKernel_::applySsse3(const FaceTurnKernel_& kernel, unsigned char* states, std::size_t nbStates,
+                                     std::size_t stride) {
+        applyScalar(kernel, states, nbStates, stride);
+    }
+
+    void FaceTurnKernel_::applyAvx2(const FaceTurnKernel_& kernel, unsigned char* states, std::size_t nbStates,
+                                    std::size_t stride) {
+        applyScalar(kernel, states, nbStates, stride);
+    }
+
+#endif
+
+}
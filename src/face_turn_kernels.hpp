@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+
+#include "cube_state.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @brief Permutation and orientation changes applied to a CubeState_ by a face rotation
+     * @details Each position receives the block previously located at the given position index, and its orientation is
+     * increased by the given amount.
+     */
+    struct FaceTurn_ {
+        unsigned char cornersPermutation[CubeState_::TOTAL_CORNERS];
+        unsigned char cornersOrientation[CubeState_::TOTAL_CORNERS];
+        unsigned char edgesPermutation[CubeState_::TOTAL_EDGES];
+        unsigned char edgesOrientation[CubeState_::TOTAL_EDGES];
+    };
+
+    /**
+     * @class FaceTurnKernel_
+     * @brief Applies a face turn to cube states stored as bytes, with the widest instructions supported by the CPU
+     * @details A state is stored as its corners permutation, corners orientations, edges permutation and edges
+     * orientations, one byte per block, which is the layout of CubeState_. On x86 processors supporting SSSE3, the
+     * corners are turned by a single byte shuffle of their 16 bytes followed by an addition modulo 3, and the edges by
+     * shuffles of two overlapping 16-byte halves followed by an exclusive or. With AVX2, batches are processed two
+     * states per instruction. Other processors use the scalar code. The implementation is selected once, on first use.
+     */
+    class FaceTurnKernel_ {
+    public:
+        static const std::size_t STATE_SIZE = 2 * CubeState_::TOTAL_CORNERS + 2 * CubeState_::TOTAL_EDGES;
+
+        FaceTurnKernel_() = default;
+
+        /**
+         * @brief precomputes the byte shuffles of a face turn
+         * @param turn face turn to apply
+         */
+        explicit FaceTurnKernel_(const FaceTurn_& turn);
+
+        /**
+         * @brief applies the face turn to a state
+         * @param state STATE_SIZE bytes of the state, modified in place
+         */
+        void apply(unsigned char* state) const;
+
+        /**
+         * @brief applies the face turn to consecutive states
+         * @param states bytes of the states, modified in place
+         * @param nbStates number of states
+         * @param stride number of bytes from a state to the next one, at least STATE_SIZE
+         */
+        void apply(unsigned char* states, std::size_t nbStates, std::size_t stride) const;
+
+        /**
+         * @brief returns the name of the implementation selected for this CPU
+         * @return "avx2", "ssse3" or "scalar"
+         */
+        static const char* getImplementation();
+
+    private:
+        using Implementation_ = void (*)(const FaceTurnKernel_&, unsigned char*, std::size_t, std::size_t);
+
+        FaceTurn_ turn_;
+
+        // Byte shuffles and orientation changes, as 16-byte vectors. Corners are handled as [permutation |
+        // orientations] and edges as their bytes 0-15 (low) and 8-23 (high) of [permutation | orientations].
+        unsigned char cornersShuffle_[16];
+        unsigned char cornersTwist_[16];
+        unsigned char cornersModulo_[16];
+        unsigned char lowFromLow_[16];
+        unsigned char lowFromHigh_[16];
+        unsigned char lowFlip_[16];
+        unsigned char highFromLow_[16];
+        unsigned char highFromHigh_[16];
+        unsigned char highFlip_[16];
+
+        static Implementation_ getSelectedImplementation();
+        static void applyScalar(const FaceTurnKernel_& kernel, unsigned char* states, std::size_t nbStates,
+                                std::size_t stride);
+        static void applySsse3(const FaceTurnKernel_& kernel, unsigned char* states, std::size_t nbStates,
+                               std::size_t stride);
+        static void applyAvx2(const FaceTurnKernel_& kernel, unsigned char* states, std::size_t nbStates,
+                              std::size_t stride);
+    };
+
+}
@@ -0,0 +1,148 @@
+#include <iostream>
+
+#include "color_finder.hpp"
+#include "cubies.hpp"
+#include "goals.hpp"
+
+
+namespace rubiks {
+
+    namespace {
+
+        // Offsets of the blocks in CubeState_
+        const std::size_t CORNERS_ORIENTATION = CubeState_::TOTAL_CORNERS;
+        const std::size_t EDGES_PERMUTATION = 2 * CubeState_::TOTAL_CORNERS;
+        const std::size_t EDGES_ORIENTATION = EDGES_PERMUTATION + CubeState_::TOTAL_EDGES;
+
+        bool hasCornerFace(unsigned short corner, const Color& face) {
+            return CORNER_FACES[corner][0] == face || CORNER_FACES[corner][1] == face
+                   || CORNER_FACES[corner][2] == face;
+        }
+
+        bool hasEdgeFace(unsigned short edge, const Color& face) {
+            return EDGE_FACES[edge][0] == face || EDGE_FACES[edge][1] == face;
+        }
+
+    }
+
+    StateGoal::StateGoal() : mask_(), expected_() {}
+
+    StateGoal& StateGoal::requireCorner(unsigned short position) {
+        if (position >= CubeState_::TOTAL_CORNERS) {
+            std::cerr << "[StateGoal] WARNING: no corner position " << position << std::endl;
+            return *this;
+        }
+        requireByte(position, (unsigned char) position);
+        requireByte(CORNERS_ORIENTATION + position, 0);
+        return *this;
+    }
+
+    StateGoal& StateGoal::requireCornerOrientation(unsigned short position) {
+        if (position >= CubeState_::TOTAL_CORNERS) {
+            std::cerr << "[StateGoal] WARNING: no corner position " << position << std::endl;
+            return *this;
+        }
+        requireByte(CORNERS_ORIENTATION + position, 0);
+        return *this;
+    }
+
+    StateGoal& StateGoal::requireEdge(unsigned short position) {
+        if (position >= CubeState_::TOTAL_EDGES) {
+            std::cerr << "[StateGoal] WARNING: no edge position " << position << std::endl;
+            return *this;
+        }
+        requireByte(EDGES_PERMUTATION + position, (unsigned char) position);
+        requireByte(EDGES_ORIENTATION + position, 0);
+        return *this;
+    }
+
+    StateGoal& StateGoal::requireEdgeOrientation(unsigned short position) {
+        if (position >= CubeState_::TOTAL_EDGES) {
+            std::cerr << "[StateGoal] WARNING: no edge position " << position << std::endl;
+            return *this;
+        }
+        requireByte(EDGES_ORIENTATION + position, 0);
+        return *this;
+    }
+
+    StateGoal& StateGoal::require(const StateGoal& other) {
+        // Both goals expect the sorted values, so their requirements never conflict
+        for (unsigned short i = 0; i < NB_WORDS; ++i) {
+            mask_[i] |= other.mask_[i];
+            expected_[i] |= other.expected_[i];
+        }
+        return *this;
+    }
+
+    void StateGoal::requireByte(std::size_t offset, unsigned char value) {
+        unsigned char mask[sizeof(CubeState_)];
+        unsigned char expected[sizeof(CubeState_)];
+        std::memcpy(mask, mask_, sizeof(mask));
+        std::memcpy(expected, expected_, sizeof(expected));
+        mask[offset] = 0xFF;
+        expected[offset] = value;
+        std::memcpy(mask_, mask, sizeof(mask));
+        std::memcpy(expected_, expected, sizeof(expected));
+    }
+
+    StateGoal getSortedGoal() {
+        StateGoal goal;
+        for (unsigned short position = 0; position < CubeState_::TOTAL_CORNERS; ++position) {
+            goal.requireCorner(position);
+        }
+        for (unsigned short position = 0; position < CubeState_::TOTAL_EDGES; ++position) {
+            goal.requireEdge(position);
+        }
+        return goal;
+    }
+
+    StateGoal getCrossGoal(const Color& face) {
+        StateGoal goal;
+        for (unsigned short position = 0; position < CubeState_::TOTAL_EDGES; ++position) {
+            if (hasEdgeFace(position, face)) goal.requireEdge(position);
+        }
+        return goal;
+    }
+
+    StateGoal getLayerGoal(const Color& face) {
+        StateGoal goal = getCrossGoal(face);
+        for (unsigned short position = 0; position < CubeState_::TOTAL_CORNERS; ++position) {
+            if (hasCornerFace(position, face)) goal.requireCorner(position);
+        }
+        return goal;
+    }
+
+    StateGoal getF2LGoal(const Color& face) {
+        StateGoal goal;
+        if (face == Color::UNDEFINED) return goal;
+        const Color lastFace = ColorFinder::getOpposite(face);
+        for (unsigned short position = 0; position < CubeState_::TOTAL_CORNERS; ++position) {
+            if (!hasCornerFace(position, lastFace)) goal.requireCorner(position);
+        }
+        for (unsigned short position = 0; position < CubeState_::TOTAL_EDGES; ++position) {
+            if (!hasEdgeFace(position, lastFace)) goal.requireEdge(position);
+        }
+        return goal;
+    }
+
+    StateGoal getOLLGoal(const Color& face) {
+        StateGoal goal = getF2LGoal(face);
+        if (face != Color::BLUE && face != Color::GREEN) {
+            std::cerr << "[StateGoal] WARNING: the orientation of the last layer can only be tested with the cross on "
+                      << "the BLUE or GREEN face, not " << face << std::endl
+                      << "[StateGoal] Using the goal of the first two layers instead" << std::endl;
+            return goal;
+        }
+
+        // The last layer is the BLUE or GREEN layer, whose blocks are oriented when they show its color
+        const Color lastFace = ColorFinder::getOpposite(face);
+        for (unsigned short position = 0; position < CubeState_::TOTAL_CORNERS; ++position) {
+            if (hasCornerFace(position, lastFace)) goal.requireCornerOrientation(position);
+        }
+        for (unsigned short position = 0; position < CubeState_::TOTAL_EDGES; ++position) {
+            if (hasEdgeFace(position, lastFace)) goal.requireEdgeOrientation(position);
+        }
+        return goal;
+    }
+
+}
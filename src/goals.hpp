@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "colors.hpp"
+#include "cube_state.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @class StateGoal
+     * @brief Partial goal of a search, tested by a masked compare of the bytes of a CubeState_
+     * @details A goal requires some blocks to be in their sorted position, with or without their orientation, and
+     * stores the bytes of the state it checks as a mask and their expected values. The 40 bytes of the state are
+     * compared as five 64-bit words, without branches, so that a goal test costs a few cycles. Goals are built by
+     * chaining requirements, such as <tt>StateGoal().requireEdge(0).requireCornerOrientation(1)</tt>.
+     */
+    class StateGoal {
+    public:
+        /**
+         * @brief creates a goal without requirement, matching every state
+         */
+        StateGoal();
+
+        /**
+         * @brief requires the corner of a position to be placed and oriented
+         * @param position corner position (0-7)
+         * @return reference to the goal
+         */
+        StateGoal& requireCorner(unsigned short position);
+
+        /**
+         * @brief requires the corner of a position to be oriented, whichever corner it is
+         * @param position corner position (0-7)
+         * @return reference to the goal
+         */
+        StateGoal& requireCornerOrientation(unsigned short position);
+
+        /**
+         * @brief requires the edge of a position to be placed and oriented
+         * @param position edge position (0-11)
+         * @return reference to the goal
+         */
+        StateGoal& requireEdge(unsigned short position);
+
+        /**
+         * @brief requires the edge of a position to be oriented, whichever edge it is
+         * @param position edge position (0-11)
+         * @return reference to the goal
+         */
+        StateGoal& requireEdgeOrientation(unsigned short position);
+
+        /**
+         * @brief adds the requirements of another goal
+         * @param other goal whose requirements are added
+         * @return reference to the goal
+         */
+        StateGoal& require(const StateGoal& other);
+
+        /**
+         * @brief returns whether a state fulfills the requirements of the goal
+         * @param state cube state
+         * @return true if the required blocks are in place, false otherwise
+         */
+        bool matches(const CubeState_& state) const {
+            std::uint64_t words[NB_WORDS];
+            std::memcpy(words, &state, sizeof(words));
+            std::uint64_t differences = 0;
+            for (unsigned short i = 0; i < NB_WORDS; ++i) {
+                differences |= (words[i] & mask_[i]) ^ expected_[i];
+            }
+            return !differences;
+        }
+
+    private:
+        static const unsigned short NB_WORDS = sizeof(CubeState_) / sizeof(std::uint64_t);
+
+        std::uint64_t mask_[NB_WORDS];      /*!< bits of the state checked by the goal */
+        std::uint64_t expected_[NB_WORDS];  /*!< values of the checked bits */
+
+        /**
+         * @brief requires a byte of the state to have a value
+         * @param offset offset of the byte in CubeState_
+         * @param value expected value
+         */
+        void requireByte(std::size_t offset, unsigned char value);
+    };
+
+    /**
+     * @brief Returns the goal matching only the sorted state.
+     * @return goal requiring every block
+     */
+    StateGoal getSortedGoal();
+
+    /**
+     * @brief Returns the goal of the cross of a face: its four edges placed and oriented.
+     * @param face face of the cross
+     * @return goal of the cross, without requirement for Color::UNDEFINED
+     */
+    StateGoal getCrossGoal(const Color& face);
+
+    /**
+     * @brief Returns the goal of a sorted layer: the corners and edges of a face placed and oriented.
+     * @param face face of the layer
+     * @return goal of the layer, without requirement for Color::UNDEFINED
+     */
+    StateGoal getLayerGoal(const Color& face);
+
+    /**
+     * @brief Returns the goal of the first two layers: every block placed and oriented, except the ones of the face
+     * opposite to the cross.
+     * @param face face of the cross
+     * @return goal of the first two layers, without requirement for Color::UNDEFINED
+     */
+    StateGoal getF2LGoal(const Color& face);
+
+    /**
+     * @brief Returns the goal of the orientation of the last layer: the first two layers sorted and the blocks of the
+     * last layer oriented, so that the last face shows a single color.
+     * @details Orientations are measured against the BLUE and GREEN faces, so the cross must be on one of them for
+     * the last layer to be tested by a masked compare.
+     * @param face face of the cross, Color::BLUE or Color::GREEN
+     * @return goal of the oriented last layer, the F2L goal for the other faces
+     */
+    StateGoal getOLLGoal(const Color& face);
+
+}
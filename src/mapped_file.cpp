@@ -0,0 +1,98 @@
+#include <cstdio>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "mapped_file.hpp"
+
+
+namespace rubiks {
+
+    MappedFile_::~MappedFile_() {
+        close();
+    }
+
+    bool MappedFile_::open(const std::string& path) {
+        close();
+        const int file = ::open(path.c_str(), O_RDONLY);
+        if (file < 0) return false;
+
+        struct stat status{};
+        void* mapping = MAP_FAILED;
+        if (fstat(file, &status) == 0 && status.st_size > 0) {
+            mapping = mmap(nullptr, (std::size_t) status.st_size, PROT_READ, MAP_SHARED, file, 0);
+        }
+        ::close(file);
+        if (mapping == MAP_FAILED) {
+            std::cerr << "[MappedFile_] WARNING: cannot map " << path << std::endl;
+            return false;
+        }
+        mapping_ = mapping;
+        size_ = (std::size_t) status.st_size;
+        return true;
+    }
+
+    void MappedFile_::close() {
+        if (mapping_) munmap(mapping_, size_);
+        mapping_ = nullptr;
+        size_ = 0;
+    }
+
+    const unsigned char* MappedFile_::data() const {
+        return static_cast<const unsigned char*>(mapping_);
+    }
+
+    std::size_t MappedFile_::size() const {
+        return size_;
+    }
+
+    AtomicFileWriter_::~AtomicFileWriter_() {
+        discard();
+    }
+
+    bool AtomicFileWriter_::open(const std::string& path) {
+        discard();
+        path_ = path;
+        temporaryPath_ = path + ".tmp." + std::to_string(getpid());
+        file_ = ::open(temporaryPath_.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        failed_ = file_ < 0;
+        if (failed_) std::cerr << "[AtomicFileWriter_] WARNING: cannot create " << temporaryPath_ << std::endl;
+        return !failed_;
+    }
+
+    bool AtomicFileWriter_::write(const void* data, std::size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        while (!failed_ && size > 0) {
+            const ssize_t written = ::write(file_, bytes, size);
+            if (written <= 0) failed_ = true;
+            else {
+                bytes += written;
+                size -= (std::size_t) written;
+            }
+        }
+        return !failed_;
+    }
+
+    bool AtomicFileWriter_::commit() {
+        if (file_ < 0) return false;
+        bool committed = !failed_ && fsync(file_) == 0;
+        committed = ::close(file_) == 0 && committed;
+        file_ = -1;
+        committed = committed && std::rename(temporaryPath_.c_str(), path_.c_str()) == 0;
+        if (!committed) {
+            std::cerr << "[AtomicFileWriter_] WARNING: cannot write " << path_ << std::endl;
+            std::remove(temporaryPath_.c_str());
+        }
+        return committed;
+    }
+
+    void AtomicFileWriter_::discard() {
+        if (file_ < 0) return;
+        ::close(file_);
+        file_ = -1;
+        std::remove(temporaryPath_.c_str());
+    }
+
+}
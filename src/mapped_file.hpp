@@ -0,0 +1,104 @@
+#pragma once
+
+#include <string>
+
+
+namespace rubiks {
+
+    /**
+     * @class MappedFile_
+     * @brief Read-only memory mapping of a whole file
+     * @details The mapping is shared, so that every process mapping the same file reads the same memory pages.
+     */
+    class MappedFile_ {
+    public:
+        MappedFile_() = default;
+
+        /**
+         * @brief unmaps the file, if any
+         */
+        ~MappedFile_();
+
+        MappedFile_(const MappedFile_&) = delete;
+        MappedFile_& operator=(const MappedFile_&) = delete;
+
+        /**
+         * @brief maps a file, printing a warning if it exists but cannot be mapped
+         * @param path path of the file
+         * @return true if the file was mapped, false if it is missing, empty or cannot be mapped
+         */
+        bool open(const std::string& path);
+
+        /**
+         * @brief unmaps the file, if any
+         */
+        void close();
+
+        /**
+         * @brief returns the bytes of the mapped file
+         * @return pointer to the first byte of the file, nullptr if no file is mapped
+         */
+        const unsigned char* data() const;
+
+        /**
+         * @brief returns the size of the mapped file
+         * @return number of bytes of the file, 0 if no file is mapped
+         */
+        std::size_t size() const;
+
+    private:
+        void* mapping_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+    /**
+     * @class AtomicFileWriter_
+     * @brief Writes a file through a temporary file, renamed over the path once complete
+     * @details Readers of the path see either the previous file or the complete new one, never a partial file.
+     */
+    class AtomicFileWriter_ {
+    public:
+        AtomicFileWriter_() = default;
+
+        /**
+         * @brief discards the temporary file if it was not committed
+         */
+        ~AtomicFileWriter_();
+
+        AtomicFileWriter_(const AtomicFileWriter_&) = delete;
+        AtomicFileWriter_& operator=(const AtomicFileWriter_&) = delete;
+
+        /**
+         * @brief creates the temporary file, next to the path
+         * @param path path of the file to write
+         * @return true if the temporary file was created
+         */
+        bool open(const std::string& path);
+
+        /**
+         * @brief appends bytes to the temporary file
+         * @param data bytes to write
+         * @param size number of bytes
+         * @return true if all the bytes were written
+         */
+        bool write(const void* data, std::size_t size);
+
+        /**
+         * @brief flushes the temporary file to the disk and renames it over the path, printing a warning on failure
+         * @return true if the file was replaced, false if it was discarded
+         */
+        bool commit();
+
+        /**
+         * @brief discards the temporary file
+         */
+        void discard();
+
+    private:
+        std::string path_;
+        std::string temporaryPath_;
+        int file_ = -1;
+        bool failed_ = false;  /*!< whether a write failed since the file was opened */
+    };
+
+}
@@ -0,0 +1,57 @@
+#include "move_observer.hpp"
+
+
+namespace rubiks {
+
+    namespace {
+
+        std::uint16_t encodeMove(const Move& move) {
+            return (std::uint16_t) (((std::uint16_t) move.faceColor << 8) | (std::uint16_t) move.rotation);
+        }
+
+        Move decodeMove(std::uint16_t code) {
+            return {(Color) (code >> 8), (Rotation) (code & 0xFF)};
+        }
+
+    }
+
+    StreamMoveObserver::StreamMoveObserver(std::ostream& os)
+            : os_(os) {}
+
+    void StreamMoveObserver::onMove(const Move& move) {
+        os_ << "Rotating face of color " << move.faceColor << " " << move.rotation << '\n';
+    }
+
+    MoveRingBuffer::MoveRingBuffer(std::size_t capacity)
+            : capacity_(capacity ? capacity : 1),
+              slots_(new std::atomic<std::uint16_t>[capacity_]),
+              nbMoves_(0) {
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            slots_[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void MoveRingBuffer::onMove(const Move& move) {
+        // Single writer: the counter is only published once the slot is written
+        const std::uint64_t index = nbMoves_.load(std::memory_order_relaxed);
+        slots_[index % capacity_].store(encodeMove(move), std::memory_order_relaxed);
+        nbMoves_.store(index + 1, std::memory_order_release);
+    }
+
+    std::uint64_t MoveRingBuffer::nbMoves() const {
+        return nbMoves_.load(std::memory_order_acquire);
+    }
+
+    std::vector<Move> MoveRingBuffer::recentMoves() const {
+        const std::uint64_t nbMoves = nbMoves_.load(std::memory_order_acquire);
+        const std::uint64_t first = nbMoves > capacity_ ? nbMoves - capacity_ : 0;
+
+        std::vector<Move> moves;
+        moves.reserve((std::size_t) (nbMoves - first));
+        for (std::uint64_t i = first; i < nbMoves; ++i) {
+            moves.push_back(decodeMove(slots_[i % capacity_].load(std::memory_order_relaxed)));
+        }
+        return moves;
+    }
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "moves.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @class MoveObserver
+     * @brief Interface notified of every face rotation applied to a Cube it is attached to
+     */
+    class MoveObserver {
+    public:
+        virtual ~MoveObserver() = default;
+
+        /**
+         * @brief called after a face of the observed cube has been rotated
+         * @param move applied move
+         */
+        virtual void onMove(const Move& move) = 0;
+    };
+
+    /**
+     * @class StreamMoveObserver
+     * @brief Traces every move in an output stream, one line per move
+     * @details The stream is not flushed after each move.
+     */
+    class StreamMoveObserver : public MoveObserver {
+    public:
+        StreamMoveObserver() = delete;
+
+        /**
+         * @brief StreamMoveObserver constructor
+         * @param os output stream in which to trace the moves, it must outlive the observer
+         */
+        explicit StreamMoveObserver(std::ostream& os);
+
+        void onMove(const Move& move) override;
+
+    private:
+        std::ostream& os_;
+    };
+
+    /**
+     * @class MoveRingBuffer
+     * @brief Keeps the most recent moves in a fixed-size lock-free ring buffer
+     * @details Moves are written by the thread rotating the observed cube and can be read concurrently from any
+     * other thread without locking. A read overlapping writes may return moves more recent than the requested window.
+     */
+    class MoveRingBuffer : public MoveObserver {
+    public:
+        MoveRingBuffer() = delete;
+
+        /**
+         * @brief MoveRingBuffer constructor
+         * @param capacity maximum number of moves kept in the buffer
+         */
+        explicit MoveRingBuffer(std::size_t capacity);
+
+        void onMove(const Move& move) override;
+
+        /**
+         * @brief returns the number of moves observed since the construction
+         * @return number of observed moves
+         */
+        std::uint64_t nbMoves() const;
+
+        /**
+         * @brief returns the most recent moves still held by the buffer
+         * @return moves in chronological order, the most recent last
+         */
+        std::vector<Move> recentMoves() const;
+
+    private:
+        std::size_t capacity_;
+        std::unique_ptr<std::atomic<std::uint16_t>[]> slots_;  /*!< encoded moves */
+        std::atomic<std::uint64_t> nbMoves_;                    /*!< total number of written moves */
+    };
+
+}
@@ -0,0 +1,31 @@
+#include "moves.hpp"
+
+
+namespace rubiks {
+
+    std::array<Move, NB_MOVES> _getAllMoves() {
+        std::array<Move, NB_MOVES> moves{};
+        for (unsigned short i = 0; i < NB_MOVES; ++i) {
+            moves[i] = getMove(i);
+        }
+        return moves;
+    }
+
+    unsigned short getMoveIndex(const Move& move) {
+        return (unsigned short) (3 * (unsigned short) move.faceColor + (unsigned short) move.rotation);
+    }
+
+    Move getMove(unsigned short index) {
+        return {(Color) (index / 3), (Rotation) (index % 3)};
+    }
+
+    Move invertMove(const Move& move) {
+        return {move.faceColor, invertRotation(move.rotation)};
+    }
+
+    std::ostream &operator<<(std::ostream &os, const Move &move) {
+        os << move.faceColor << " " << move.rotation;
+        return os;
+    }
+
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <ostream>
+
+#include "colors.hpp"
+#include "rotations.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @struct Move
+     * @brief Rotation of a cube face, the face being designated by the color of its middle block
+     */
+    struct Move {
+        Color faceColor;    /*!< color of the rotated face */
+        Rotation rotation;  /*!< rotation direction */
+    };
+
+    /**
+     * @brief Number of distinct moves: 6 faces, each rotated clockwise, anticlockwise or by a half turn
+     */
+    const unsigned short NB_MOVES = 18;
+
+    /**
+     * @brief Returns all possible values of Move.
+     * @details The move at index <tt>3 * (face color) + (rotation)</tt> rotates the face of that color in that
+     * direction, so that moves of a same face are contiguous.
+     * @return Array of Moves
+     */
+    std::array<Move, NB_MOVES> _getAllMoves();
+
+    /**
+     * @brief Returns the index of a move in the array returned by _getAllMoves().
+     * @param move Move to index
+     * @return Index of the move
+     */
+    unsigned short getMoveIndex(const Move& move);
+
+    /**
+     * @brief Returns the move at a given index in the array returned by _getAllMoves().
+     * @param index Index of the move (0-17)
+     * @return Move at this index
+     */
+    Move getMove(unsigned short index);
+
+    /**
+     * @brief Returns the move cancelling the input move.
+     * @param move Move to invert
+     * @return Rotation of the same face in the opposite direction
+     */
+    Move invertMove(const Move& move);
+
+    /**
+     * @brief Prints a Move value in the ostream.
+     * @param os Output stream in which to print the Move value
+     * @param move Element to print
+     * @return Reference to the modified os stream
+     */
+    std::ostream &operator<<(std::ostream &os, const Move &move);
+
+}
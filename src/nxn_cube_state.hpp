@@ -0,0 +1,264 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <type_traits>
+
+#include "colors.hpp"
+#include "rotations.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @brief Geometry of the facelets of the NxN cubes, in a frame where x points to the YELLOW face, y to the BLUE
+     * face and z to the RED face
+     * @details Positions are doubled, so that they are integers for every N: the facelets of a face lie on the plane
+     * at N along its normal, and their centers are spaced by 2.
+     */
+    namespace nxn_geometry_ {
+
+        /**
+         * @brief Integer vector of the doubled frame
+         */
+        struct Vector_ {
+            int x;
+            int y;
+            int z;
+        };
+
+        constexpr Vector_ add(const Vector_& u, const Vector_& v) {
+            return {u.x + v.x, u.y + v.y, u.z + v.z};
+        }
+
+        constexpr Vector_ scale(int k, const Vector_& v) {
+            return {k * v.x, k * v.y, k * v.z};
+        }
+
+        constexpr int dot(const Vector_& u, const Vector_& v) {
+            return u.x * v.x + u.y * v.y + u.z * v.z;
+        }
+
+        constexpr Vector_ cross(const Vector_& u, const Vector_& v) {
+            return {u.y * v.z - u.z * v.y, u.z * v.x - u.x * v.z, u.x * v.y - u.y * v.x};
+        }
+
+        /**
+         * @brief Outward normals of the faces, indexed by Color
+         */
+        constexpr Vector_ NORMALS[NB_COLORS] = {{0, 0, 1}, {0, -1, 0}, {0, 1, 0}, {1, 0, 0}, {0, 0, -1}, {-1, 0, 0}};
+
+        /**
+         * @brief Directions of the increasing columns of the faces, from left to right, seen from outside
+         */
+        constexpr Vector_ COLUMNS[NB_COLORS] = {{1, 0, 0}, {1, 0, 0}, {1, 0, 0}, {0, 0, -1}, {-1, 0, 0}, {0, 0, 1}};
+
+        /**
+         * @brief Directions of the increasing rows of the faces, from the top row down
+         * @details The BLUE face is seen with the ORANGE face up and the GREEN face with the RED face up; the other
+         * faces are seen with the BLUE face up.
+         */
+        constexpr Vector_ ROWS[NB_COLORS] = {{0, -1, 0}, {0, 0, -1}, {0, 0, 1}, {0, -1, 0}, {0, -1, 0}, {0, -1, 0}};
+
+        /**
+         * @brief Rotates a vector by a quarter or half turn around an axis.
+         * @param v vector to rotate
+         * @param axis unit axis of the rotation, pointing to the viewer
+         * @param rotation direction of the rotation, as seen from the viewer
+         * @return rotated vector
+         */
+        constexpr Vector_ rotate(const Vector_& v, const Vector_& axis, Rotation rotation) {
+            const Vector_ parallel = scale(dot(axis, v), axis);
+            const Vector_ orthogonal = add(v, scale(-1, parallel));
+            if (rotation == Rotation::HALF_TURN) return add(parallel, scale(-1, orthogonal));
+            const Vector_ turned = cross(axis, v);
+            return add(parallel, rotation == Rotation::ANTICLOCKWISE ? turned : scale(-1, turned));
+        }
+
+    }
+
+    /**
+     * @brief Source facelet of every facelet after each layer turn of a NxN cube, built at compile time
+     * @details The layers are selected by a face and their depth from it, 0 being the face itself: the inner layers
+     * of the cube are reached from either side. Turns are oriented as seen from the selecting face.
+     * @tparam N number of layers of the cube
+     */
+    template <unsigned short N>
+    struct NxNMoveTables_ {
+        static const unsigned short NB_FACELETS = NB_COLORS * N * N;
+
+        /**
+         * @brief Smallest type indexing the facelets
+         */
+        using Index = typename std::conditional<NB_FACELETS <= 256, std::uint8_t, std::uint16_t>::type;
+
+        Index sources[NB_COLORS][N][3][NB_FACELETS];
+
+        constexpr NxNMoveTables_() : sources() {
+            using namespace nxn_geometry_;
+            for (unsigned short face = 0; face < NB_COLORS; ++face) {
+                for (unsigned short depth = 0; depth < N; ++depth) {
+                    for (unsigned short rotation = 0; rotation < 3; ++rotation) {
+                        Index* source = sources[face][depth][rotation];
+                        for (unsigned short facelet = 0; facelet < NB_FACELETS; ++facelet) {
+                            source[facelet] = (Index) facelet;
+                        }
+                        for (unsigned short facelet = 0; facelet < NB_FACELETS; ++facelet) {
+                            const unsigned short faceletFace = facelet / (N * N);
+                            const Vector_ normal = NORMALS[faceletFace];
+                            const Vector_ position = getPosition(facelet);
+
+                            // The center of the block of a facelet is 1 under the surface
+                            if (dot(add(position, scale(-1, normal)), NORMALS[face]) != N - 1 - 2 * depth) continue;
+                            const Vector_ target = rotate(position, NORMALS[face], (Rotation) rotation);
+                            source[getFacelet(target, rotate(normal, NORMALS[face], (Rotation) rotation))] =
+                                    (Index) facelet;
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Computes the doubled position of the center of a facelet.
+         * @param facelet index of the facelet, face by face and row by row
+         * @return position of the facelet
+         */
+        static constexpr nxn_geometry_::Vector_ getPosition(unsigned short facelet) {
+            using namespace nxn_geometry_;
+            const unsigned short face = facelet / (N * N);
+            const int row = facelet / N % N;
+            const int column = facelet % N;
+            return add(add(scale(N, NORMALS[face]), scale(2 * column - (N - 1), COLUMNS[face])),
+                       scale(2 * row - (N - 1), ROWS[face]));
+        }
+
+        /**
+         * @brief Computes the index of the facelet at a doubled position.
+         * @param position position of the facelet
+         * @param normal outward normal of the face holding the facelet
+         * @return index of the facelet, face by face and row by row
+         */
+        static constexpr unsigned short getFacelet(const nxn_geometry_::Vector_& position,
+                                                   const nxn_geometry_::Vector_& normal) {
+            using namespace nxn_geometry_;
+            unsigned short face = 0;
+            while (dot(NORMALS[face], normal) != 1) ++face;
+            const int row = (dot(position, ROWS[face]) + N - 1) / 2;
+            const int column = (dot(position, COLUMNS[face]) + N - 1) / 2;
+            return (unsigned short) (face * N * N + row * N + column);
+        }
+    };
+
+    /**
+     * @class CubeState
+     * @brief State of a NxN cube, stored as the colors of its facelets
+     * @details Each face is laid out row by row, as seen from outside: the RED, ORANGE, YELLOW and WHITE faces with
+     * the BLUE face up, the BLUE face with the ORANGE face up and the GREEN face with the RED face up. The faces are
+     * ordered as the Color values. The move tables of each size are built at compile time, so that the turns of each
+     * size compile to their own fixed-size loop.
+     * @tparam N number of layers of the cube, from 2 to 7
+     */
+    template <unsigned short N>
+    class CubeState {
+        static_assert(N >= 2 && N <= 7, "CubeState supports 2 to 7 layers");
+
+    public:
+        static const unsigned short SIZE = N;
+        static const unsigned short NB_FACELETS = NxNMoveTables_<N>::NB_FACELETS;
+
+        /**
+         * @brief creates a sorted state, each face holding its own color
+         */
+        CubeState() : facelets_() {
+            for (unsigned short facelet = 0; facelet < NB_FACELETS; ++facelet) {
+                facelets_[facelet] = (unsigned char) (facelet / (N * N));
+            }
+        }
+
+        /**
+         * @brief returns whether each face holds a single color
+         * @details Inner layer turns move the centers of the faces, so a sorted state may be a whole cube rotation of
+         * the initial state.
+         * @return true if the cube is sorted, false otherwise
+         */
+        bool isSorted() const {
+            for (unsigned short facelet = 0; facelet < NB_FACELETS; ++facelet) {
+                if (facelets_[facelet] != facelets_[facelet - facelet % (N * N)]) return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief retrieves the color of a facelet
+         * @param face face holding the facelet
+         * @param row row of the facelet (0 to N - 1), from the top
+         * @param column column of the facelet (0 to N - 1), from the left
+         * @return color of the facelet, Color::UNDEFINED if the facelet does not exist
+         */
+        Color getFacelet(const Color& face, unsigned short row, unsigned short column) const {
+            if (face == Color::UNDEFINED || row >= N || column >= N) {
+                std::cerr << "[CubeState] WARNING: no facelet at row " << row << " and column " << column
+                          << " of face " << face << std::endl;
+                return Color::UNDEFINED;
+            }
+            return (Color) facelets_[(unsigned short) face * N * N + row * N + column];
+        }
+
+        /**
+         * @brief retrieves the colors of all the facelets
+         * @return colors of the faces ordered as the Color values, each one laid out row by row
+         */
+        const std::array<unsigned char, NB_FACELETS>& getFacelets() const {
+            return facelets_;
+        }
+
+        /**
+         * @brief rotates the outer layer of a face
+         * @param face face to rotate
+         * @param rotation rotation direction, as seen from the face
+         */
+        void rotateFace(const Color& face, const Rotation& rotation) {
+            rotateLayer(face, 0, rotation);
+        }
+
+        /**
+         * @brief rotates a layer of the cube, such as the slice between two opposite faces
+         * @details The layer at depth d from a face is the layer at depth N - 1 - d from the opposite face, where
+         * it turns in the opposite direction.
+         * @param face face from which the layer is selected and seen
+         * @param depth depth of the layer (0 to N - 1), 0 being the face itself
+         * @param rotation rotation direction, as seen from the face
+         */
+        void rotateLayer(const Color& face, unsigned short depth, const Rotation& rotation) {
+            if (face == Color::UNDEFINED || depth >= N) {
+                std::cerr << "[CubeState] WARNING: no layer at depth " << depth << " from face " << face << std::endl;
+                return;
+            }
+            const auto& sources = MOVE_TABLES.sources[(unsigned short) face][depth][(unsigned short) rotation];
+            std::array<unsigned char, NB_FACELETS> facelets;
+            for (unsigned short facelet = 0; facelet < NB_FACELETS; ++facelet) {
+                facelets[facelet] = facelets_[sources[facelet]];
+            }
+            facelets_ = facelets;
+        }
+
+        bool operator==(const CubeState& other) const {
+            return facelets_ == other.facelets_;
+        }
+
+        bool operator!=(const CubeState& other) const {
+            return !(*this == other);
+        }
+
+    private:
+        static constexpr NxNMoveTables_<N> MOVE_TABLES{};
+
+        std::array<unsigned char, NB_FACELETS> facelets_;  /*!< color of each facelet */
+    };
+
+    template <unsigned short N>
+    constexpr NxNMoveTables_<N> CubeState<N>::MOVE_TABLES;
+
+}
@@ -0,0 +1,185 @@
+#include <algorithm>
+
+#include "coordinates.hpp"
+#include "optimal_solver.hpp"
+#include "stats.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @brief Context of a solver run
+     */
+    struct OptimalSolver::Search_ {
+        const SolveLimits& limits;
+        std::chrono::steady_clock::time_point deadline;
+        std::uint64_t nbNodes;
+        bool aborted;
+        SolveStatus abortStatus;
+        std::vector<unsigned short> path;
+    };
+
+    OptimalSolver::OptimalSolver()
+            : cornersPermutationMoves_(NB_CORNERS_PERMUTATIONS * NB_MOVES),
+              cornersOrientationMoves_(NB_CORNERS_ORIENTATIONS * NB_MOVES),
+              edgesGroupMoves_(NB_EDGES_GROUP_PERMUTATIONS * NB_MOVES),
+              cornersTable_((std::uint64_t) NB_CORNERS_PERMUTATIONS * NB_CORNERS_ORIENTATIONS),
+              firstEdgesTable_((std::uint64_t) NB_EDGES_GROUP_PERMUTATIONS * NB_EDGES_GROUP_ORIENTATIONS),
+              secondEdgesTable_((std::uint64_t) NB_EDGES_GROUP_PERMUTATIONS * NB_EDGES_GROUP_ORIENTATIONS),
+              oppositeFaces_() {
+        for (unsigned short face = 0; face < CubeState_::NB_FACES; ++face) {
+            oppositeFaces_[face] = (unsigned short) ColorFinder::getOpposite((Color) face);
+        }
+
+        // Move tables
+        for (std::uint16_t rank = 0; rank < NB_CORNERS_PERMUTATIONS; ++rank) {
+            CubeState_ state;
+            unrankCornersPermutation(rank, state);
+            for (unsigned short move = 0; move < NB_MOVES; ++move) {
+                CubeState_ next(state);
+                next.rotateFace(getMove(move).faceColor, getMove(move).rotation);
+                cornersPermutationMoves_[rank * NB_MOVES + move] = rankCornersPermutation(next);
+            }
+        }
+        for (std::uint16_t rank = 0; rank < NB_CORNERS_ORIENTATIONS; ++rank) {
+            CubeState_ state;
+            unrankCornersOrientation(rank, state);
+            for (unsigned short move = 0; move < NB_MOVES; ++move) {
+                CubeState_ next(state);
+                next.rotateFace(getMove(move).faceColor, getMove(move).rotation);
+                cornersOrientationMoves_[rank * NB_MOVES + move] = rankCornersOrientation(next);
+            }
+        }
+        for (std::uint32_t rank = 0; rank < NB_EDGES_GROUP_PERMUTATIONS; ++rank) {
+            CubeState_ state;
+            unrankEdgesGroupPermutation(rank, state);
+            // Orientations of the group are all 0, so the coordinate after the move holds the flipped edges
+            for (unsigned short move = 0; move < NB_MOVES; ++move) {
+                CubeState_ next(state);
+                next.rotateFace(getMove(move).faceColor, getMove(move).rotation);
+                edgesGroupMoves_[rank * NB_MOVES + move] = rankEdgesGroup(next, 0);
+            }
+        }
+
+        // Pattern databases
+        CubeState_ sortedState;
+        const auto cornersNeighbour = [this](std::uint64_t index, unsigned short move) {
+            const auto permutation = (std::uint32_t) (index / NB_CORNERS_ORIENTATIONS);
+            const auto orientation = (std::uint32_t) (index % NB_CORNERS_ORIENTATIONS);
+            return (std::uint64_t) cornersPermutationMoves_[permutation * NB_MOVES + move] * NB_CORNERS_ORIENTATIONS
+                   + cornersOrientationMoves_[orientation * NB_MOVES + move];
+        };
+        cornersTable_.generate((std::uint64_t) rankCornersPermutation(sortedState) * NB_CORNERS_ORIENTATIONS
+                               + rankCornersOrientation(sortedState), NB_MOVES, cornersNeighbour);
+
+        const auto edgesNeighbour = [this](std::uint64_t index, unsigned short move) {
+            const auto permutation = (std::uint32_t) (index / NB_EDGES_GROUP_ORIENTATIONS);
+            return (std::uint64_t) (edgesGroupMoves_[permutation * NB_MOVES + move]
+                                    ^ (index % NB_EDGES_GROUP_ORIENTATIONS));
+        };
+        firstEdgesTable_.generate(rankEdgesGroup(sortedState, 0), NB_MOVES, edgesNeighbour);
+        secondEdgesTable_.generate(rankEdgesGroup(sortedState, EDGES_GROUP_SIZE), NB_MOVES, edgesNeighbour);
+    }
+
+    SolveResult OptimalSolver::solve(const CubeState_ &state, const SolveLimits &limits) const {
+        SolveResult result;
+        if (!state.isSolvable()) {
+            result.status = SolveStatus::UNSOLVABLE;
+            return result;
+        }
+        if (state.isSorted()) {
+            result.status = SolveStatus::SOLVED;
+            return result;
+        }
+
+        Search_ search{limits, std::chrono::steady_clock::now() + limits.timeLimit, 0, false,
+                       SolveStatus::NOT_FOUND, std::vector<unsigned short>(limits.maxLength)};
+        const Node_ root = makeNode(state);
+
+        result.status = SolveStatus::NOT_FOUND;
+        for (unsigned short bound = estimateDistance(root); bound <= limits.maxLength; ++bound) {
+            if (this->search(search, root, 0, bound, CubeState_::NB_FACES)) {
+                for (unsigned short i = 0; i < bound; ++i) {
+                    result.moves.push_back(getMove(search.path[i]));
+                }
+                result.status = SolveStatus::SOLVED;
+                break;
+            }
+            if (search.aborted) {
+                result.status = search.abortStatus;
+                break;
+            }
+        }
+        result.nbNodes = search.nbNodes;
+        return result;
+    }
+
+    std::size_t OptimalSolver::memorySize() const {
+        return cornersPermutationMoves_.size() * sizeof(std::uint16_t)
+               + cornersOrientationMoves_.size() * sizeof(std::uint16_t)
+               + edgesGroupMoves_.size() * sizeof(std::uint32_t)
+               + cornersTable_.memorySize() + firstEdgesTable_.memorySize() + secondEdgesTable_.memorySize();
+    }
+
+    OptimalSolver::Node_ OptimalSolver::makeNode(const CubeState_ &state) const {
+        return {rankCornersPermutation(state), rankCornersOrientation(state),
+                rankEdgesGroup(state, 0), rankEdgesGroup(state, EDGES_GROUP_SIZE)};
+    }
+
+    OptimalSolver::Node_ OptimalSolver::applyMove(const Node_ &node, unsigned short move) const {
+        // Edges groups coordinates are permutation * 64 + orientations, and the move table holds the flips to apply
+        return {cornersPermutationMoves_[node.cornersPermutation * NB_MOVES + move],
+                cornersOrientationMoves_[node.cornersOrientation * NB_MOVES + move],
+                edgesGroupMoves_[(node.firstEdges / NB_EDGES_GROUP_ORIENTATIONS) * NB_MOVES + move]
+                ^ (node.firstEdges % NB_EDGES_GROUP_ORIENTATIONS),
+                edgesGroupMoves_[(node.secondEdges / NB_EDGES_GROUP_ORIENTATIONS) * NB_MOVES + move]
+                ^ (node.secondEdges % NB_EDGES_GROUP_ORIENTATIONS)};
+    }
+
+    unsigned char OptimalSolver::estimateDistance(const Node_ &node) const {
+        const unsigned char corners = cornersTable_.get(
+                (std::uint64_t) node.cornersPermutation * NB_CORNERS_ORIENTATIONS + node.cornersOrientation);
+        const unsigned char firstEdges = firstEdgesTable_.get(node.firstEdges);
+        const unsigned char secondEdges = secondEdgesTable_.get(node.secondEdges);
+        return std::max(corners, std::max(firstEdges, secondEdges));
+    }
+
+    bool OptimalSolver::search(Search_ &search, const Node_ &node, unsigned short depth, unsigned short bound,
+                               unsigned short lastFace) const {
+        for (unsigned short move = 0; move < NB_MOVES; ++move) {
+            // Skip moves of the last rotated face, and only rotate commuting opposite faces in one order
+            const unsigned short face = move / 3;
+            if (face == lastFace || (face < lastFace && oppositeFaces_[face] == lastFace)) continue;
+
+            ++search.nbNodes;
+            countStat(Stat::SOLVER_NODES);
+            if (search.limits.maxNodes && search.nbNodes > search.limits.maxNodes) {
+                search.aborted = true;
+                search.abortStatus = SolveStatus::NODE_LIMIT_REACHED;
+                return false;
+            }
+            if (search.limits.timeLimit.count() && !(search.nbNodes & 0xFFF)
+                && std::chrono::steady_clock::now() >= search.deadline) {
+                search.aborted = true;
+                search.abortStatus = SolveStatus::TIME_LIMIT_REACHED;
+                return false;
+            }
+
+            const Node_ next = applyMove(node, move);
+            const unsigned char distance = estimateDistance(next);
+            countStat(Stat::PRUNING_LOOKUPS);
+            if (depth + 1 + distance > bound) {
+                countStat(Stat::PRUNING_CUTOFFS);
+                continue;
+            }
+
+            search.path[depth] = move;
+            // All the blocks are sorted when every pattern database is at distance 0
+            if (!distance) return true;
+            if (this->search(search, next, (unsigned short) (depth + 1), bound, face)) return true;
+            if (search.aborted) return false;
+        }
+        return false;
+    }
+
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "cube_state.hpp"
+#include "pruning_table.hpp"
+#include "solving.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @class OptimalSolver
+     * @brief Finds shortest solutions, in number of face turns (half turns included), of cube states
+     * @details The solver runs an iterative-deepening A* search guided by three pattern databases: the number of moves
+     * needed to sort the corners, and to sort each half of the edges. The tables are built once by the constructor,
+     * which takes a few tens of seconds and about 140 MB. The search itself only uses memory proportional to the
+     * solution length, and solve() can be called concurrently from several threads on the same solver.
+     */
+    class OptimalSolver {
+    public:
+        /**
+         * @brief builds the move tables and the pattern databases
+         */
+        OptimalSolver();
+
+        ~OptimalSolver() = default;
+
+        /**
+         * @brief searches a shortest sequence of moves sorting the given state
+         * @param state cube state to sort
+         * @param limits maximum solution length, number of expanded nodes and duration of the search
+         * @return status of the search and, if found, the solution moves
+         */
+        SolveResult solve(const CubeState_& state, const SolveLimits& limits = SolveLimits()) const;
+
+        /**
+         * @brief returns the memory used by the move tables and the pattern databases
+         * @return size of the tables in bytes
+         */
+        std::size_t memorySize() const;
+
+    private:
+        /**
+         * @brief Coordinates of a node of the search
+         */
+        struct Node_ {
+            std::uint16_t cornersPermutation;
+            std::uint16_t cornersOrientation;
+            std::uint32_t firstEdges;
+            std::uint32_t secondEdges;
+        };
+
+        struct Search_;
+
+        std::vector<std::uint16_t> cornersPermutationMoves_;  /*!< corners permutation coordinate after each move */
+        std::vector<std::uint16_t> cornersOrientationMoves_;  /*!< corners orientation coordinate after each move */
+        std::vector<std::uint32_t> edgesGroupMoves_;          /*!< half-edges coordinate after each move */
+
+        PruningTable_ cornersTable_;       /*!< pattern database of the corners */
+        PruningTable_ firstEdgesTable_;    /*!< pattern database of the edges 0-5 */
+        PruningTable_ secondEdgesTable_;   /*!< pattern database of the edges 6-11 */
+
+        std::array<unsigned short, CubeState_::NB_FACES> oppositeFaces_;  /*!< index of the opposite of each face */
+
+        Node_ makeNode(const CubeState_& state) const;
+        Node_ applyMove(const Node_& node, unsigned short move) const;
+        unsigned char estimateDistance(const Node_& node) const;
+
+        bool search(Search_& search, const Node_& node, unsigned short depth, unsigned short bound,
+                    unsigned short lastFace) const;
+    };
+
+}
@@ -0,0 +1,24 @@
+#include "pruning_table.hpp"
+
+
+namespace rubiks {
+
+    PruningTable_::PruningTable_(std::uint64_t nbEntries)
+            : nbEntries_(nbEntries), data_((std::size_t) ((nbEntries + 1) / 2), 0xFF), entries_(data_.data()) {}
+
+    PruningTable_::PruningTable_(std::uint64_t nbEntries, const unsigned char* data)
+            : nbEntries_(nbEntries), data_(), entries_(data) {}
+
+    std::uint64_t PruningTable_::nbEntries() const {
+        return nbEntries_;
+    }
+
+    std::size_t PruningTable_::memorySize() const {
+        return (std::size_t) ((nbEntries_ + 1) / 2);
+    }
+
+    const unsigned char* PruningTable_::data() const {
+        return entries_;
+    }
+
+}
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+
+namespace rubiks {
+
+    /**
+     * @class PruningTable_
+     * @brief Table of distances to the sorted state, indexed by a coordinate of the cube state
+     * @details Distances are packed on 4 bits, so that two entries share a byte. The table is filled by a breadth-first
+     * search from the sorted coordinate, and its entries are admissible lower bounds of the number of moves needed to
+     * sort any state having the same coordinate. A table either owns its entries, or reads entries stored elsewhere,
+     * such as in a memory-mapped file (see TableFile_).
+     */
+    class PruningTable_ {
+    public:
+        static const unsigned char UNKNOWN = 0xF;  /*!< value of the entries that were not reached yet */
+
+        PruningTable_() = default;
+
+        /**
+         * @brief builds a table whose entries are all unknown
+         * @param nbEntries number of entries of the table
+         */
+        explicit PruningTable_(std::uint64_t nbEntries);
+
+        /**
+         * @brief builds a read-only table over entries stored elsewhere, which must outlive the table
+         * @param nbEntries number of entries of the table
+         * @param data packed entries, as returned by data()
+         */
+        PruningTable_(std::uint64_t nbEntries, const unsigned char* data);
+
+        ~PruningTable_() = default;
+
+        PruningTable_(const PruningTable_&) = delete;
+        PruningTable_& operator=(const PruningTable_&) = delete;
+        PruningTable_(PruningTable_&&) = default;
+        PruningTable_& operator=(PruningTable_&&) = default;
+
+        /**
+         * @brief retrieves a distance
+         * @param index index of the entry
+         * @return distance stored at the given index
+         */
+        unsigned char get(std::uint64_t index) const {
+            const unsigned char byte = entries_[index >> 1];
+            return (index & 1) ? (unsigned char) (byte >> 4) : (unsigned char) (byte & 0xF);
+        }
+
+        /**
+         * @brief stores a distance, in a table owning its entries
+         * @param index index of the entry
+         * @param distance distance to store (0-15)
+         */
+        void set(std::uint64_t index, unsigned char distance) {
+            unsigned char& byte = data_[index >> 1];
+            byte = (index & 1) ? (unsigned char) ((byte & 0x0F) | (distance << 4))
+                               : (unsigned char) ((byte & 0xF0) | distance);
+        }
+
+        /**
+         * @brief fills the table by a breadth-first search from the sorted coordinate
+         * @details The search expands the frontier forward while it is small, then looks backward from the unknown
+         * entries for the last levels, which are the largest.
+         * @tparam Neighbour callable returning the coordinate reached from a coordinate by a move index
+         * @param solvedIndex coordinate of the sorted state
+         * @param nbMoves number of moves
+         * @param neighbour callable <tt>std::uint64_t(std::uint64_t index, unsigned short move)</tt>
+         */
+        template <class Neighbour>
+        void generate(std::uint64_t solvedIndex, unsigned short nbMoves, Neighbour neighbour);
+
+        /**
+         * @brief fills a symmetry-reduced table by a breadth-first search from the sorted coordinate
+         * @details Entries of symmetric states share their distance: whenever an entry is reached, the entries
+         * equivalent to it are filled as well, since the search may only reach one of them.
+         * @tparam Neighbour callable returning the coordinate reached from a coordinate by a move index
+         * @tparam Equivalents callable visiting the coordinates having the same distance as a coordinate
+         * @param solvedIndex coordinate of the sorted state
+         * @param nbMoves number of moves
+         * @param neighbour callable <tt>std::uint64_t(std::uint64_t index, unsigned short move)</tt>
+         * @param equivalents callable <tt>void(std::uint64_t index, Visitor visit)</tt>, calling
+         * <tt>visit(std::uint64_t)</tt> on each coordinate equivalent to the index
+         */
+        template <class Neighbour, class Equivalents>
+        void generate(std::uint64_t solvedIndex, unsigned short nbMoves, Neighbour neighbour, Equivalents equivalents);
+
+        /**
+         * @brief returns the number of entries of the table
+         * @return number of entries
+         */
+        std::uint64_t nbEntries() const;
+
+        /**
+         * @brief returns the memory used by the table entries
+         * @return size of the table in bytes
+         */
+        std::size_t memorySize() const;
+
+        /**
+         * @brief returns the packed entries, two per byte with the even entries in the low bits
+         * @return pointer to the memorySize() bytes of entries
+         */
+        const unsigned char* data() const;
+
+    private:
+        std::uint64_t nbEntries_ = 0;
+        std::vector<unsigned char> data_;        /*!< entries owned by the table, empty for a read-only table */
+        const unsigned char* entries_ = nullptr; /*!< entries read by get(), owned or not */
+    };
+
+    template <class Neighbour>
+    void PruningTable_::generate(std::uint64_t solvedIndex, unsigned short nbMoves, Neighbour neighbour) {
+        generate(solvedIndex, nbMoves, neighbour, [](std::uint64_t, const std::function<void(std::uint64_t)>&) {});
+    }
+
+    template <class Neighbour, class Equivalents>
+    void PruningTable_::generate(std::uint64_t solvedIndex, unsigned short nbMoves, Neighbour neighbour,
+                                 Equivalents equivalents) {
+        std::fill(data_.begin(), data_.end(), 0xFF);
+
+        std::uint64_t nbNewEntries = 0;
+        unsigned char distance = 0;
+        const std::function<void(std::uint64_t)> fill = [this, &nbNewEntries, &distance](std::uint64_t index) {
+            if (get(index) != UNKNOWN) return;
+            set(index, distance);
+            ++nbNewEntries;
+        };
+        const auto fillWithEquivalents = [&fill, &equivalents](std::uint64_t index) {
+            fill(index);
+            equivalents(index, fill);
+        };
+
+        fillWithEquivalents(solvedIndex);
+        std::uint64_t nbFilled = nbNewEntries;
+        for (unsigned char depth = 0; nbFilled < nbEntries_ && depth + 1 < UNKNOWN; ++depth) {
+            nbNewEntries = 0;
+            distance = (unsigned char) (depth + 1);
+            const bool backward = 2 * nbFilled > nbEntries_;
+
+            for (std::uint64_t index = 0; index < nbEntries_; ++index) {
+                if (backward) {
+                    // Unknown entries having a neighbour at the current depth are one move further
+                    if (get(index) != UNKNOWN) continue;
+                    for (unsigned short move = 0; move < nbMoves; ++move) {
+                        if (get(neighbour(index, move)) == depth) {
+                            fillWithEquivalents(index);
+                            break;
+                        }
+                    }
+                }
+                else {
+                    // Unknown neighbours of the entries at the current depth are one move further
+                    if (get(index) != depth) continue;
+                    for (unsigned short move = 0; move < nbMoves; ++move) {
+                        const std::uint64_t next = neighbour(index, move);
+                        if (get(next) == UNKNOWN) fillWithEquivalents(next);
+                    }
+                }
+            }
+
+            if (!nbNewEntries) break;
+            nbFilled += nbNewEntries;
+        }
+    }
+
+}
@@ -1,11 +1,90 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <random>
 
 
 namespace rubiks {
 
+    /**
+     * @class Xoshiro256
+     * @brief Small and fast pseudo-random number generator (xoshiro256**), satisfying UniformRandomBitGenerator
+     * @details The 32-byte state is seeded from a single 64-bit value through splitmix64, so that a seed gives the
+     * same sequence on every platform.
+     */
+    class Xoshiro256 {
+    public:
+        using result_type = std::uint64_t;
+
+        /**
+         * @brief Xoshiro256 constructor
+         * @param seed seed of the sequence
+         */
+        explicit Xoshiro256(std::uint64_t seed) {
+            this->seed(seed);
+        }
+
+        /**
+         * @brief restarts the sequence from a seed
+         * @param seed seed of the sequence
+         */
+        void seed(std::uint64_t seed) {
+            for (std::uint64_t& word: state_) {
+                seed += 0x9E3779B97F4A7C15ULL;
+                std::uint64_t z = seed;
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+                word = z ^ (z >> 31);
+            }
+        }
+
+        /**
+         * @brief draws the next 64 random bits
+         * @return uniformly distributed value
+         */
+        std::uint64_t operator()() {
+            const std::uint64_t result = rotateLeft(state_[1] * 5, 7) * 9;
+            const std::uint64_t t = state_[1] << 17;
+            state_[2] ^= state_[0];
+            state_[3] ^= state_[1];
+            state_[1] ^= state_[2];
+            state_[0] ^= state_[3];
+            state_[2] ^= t;
+            state_[3] = rotateLeft(state_[3], 45);
+            return result;
+        }
+
+        /**
+         * @brief draws an integer lower than a bound, from a single draw
+         * @details The bound is applied by multiplying the upper 32 bits, whose bias is negligible for small bounds.
+         * @param bound number of possible values (at most 2^32)
+         * @return uniformly distributed value in [0, bound)
+         */
+        std::uint32_t below(std::uint32_t bound) {
+            return (std::uint32_t) (((*this)() >> 32) * bound >> 32);
+        }
+
+        static constexpr std::uint64_t min() { return 0; }
+        static constexpr std::uint64_t max() { return UINT64_MAX; }
+
+    private:
+        std::array<std::uint64_t, 4> state_;
+
+        static std::uint64_t rotateLeft(std::uint64_t x, int k) {
+            return (x << k) | (x >> (64 - k));
+        }
+    };
+
+    /**
+     * @brief Draws a 64-bit seed from the non-deterministic random device, for the engines seeded per thread.
+     * @return seed made of two 32-bit draws
+     */
+    inline std::uint64_t drawSeed() {
+        std::random_device randomDevice;
+        return ((std::uint64_t) randomDevice() << 32) ^ randomDevice();
+    }
+
     /**
      * @class RandomGenerator<T, N>
      * @brief Draws random samples from an input array with a uniform distribution
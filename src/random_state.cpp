@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <array>
+
+#include "coordinates.hpp"
+#include "random_state.hpp"
+
+
+namespace rubiks {
+
+    namespace {
+
+        const std::size_t CHUNK_SIZE = 4096;  /*!< number of states drawn from the same engine by a worker */
+
+        /**
+         * @brief Shuffles blocks with the Fisher-Yates algorithm.
+         * @return parity of the drawn permutation
+         */
+        template <std::size_t N>
+        bool drawPermutation(std::array<unsigned char, N>& blocks, Xoshiro256& engine) {
+            bool odd = false;
+            for (std::size_t i = N - 1; i > 0; --i) {
+                const std::uint32_t j = engine.below((std::uint32_t) (i + 1));
+                if (j != i) {
+                    std::swap(blocks[i], blocks[j]);
+                    odd = !odd;
+                }
+            }
+            return odd;
+        }
+
+        Xoshiro256& getThreadEngine() {
+            thread_local Xoshiro256 engine(drawSeed());
+            return engine;
+        }
+
+    }
+
+    CubeState_ drawRandomState(Xoshiro256& engine) {
+        std::array<unsigned char, CubeState_::TOTAL_CORNERS> corners{};
+        std::array<unsigned char, CubeState_::TOTAL_EDGES> edges{};
+        for (unsigned char i = 0; i < CubeState_::TOTAL_CORNERS; ++i) corners[i] = i;
+        for (unsigned char i = 0; i < CubeState_::TOTAL_EDGES; ++i) edges[i] = i;
+
+        // Swapping the last two edges maps the odd edges permutations onto the even ones one to one
+        const bool cornersParity = drawPermutation(corners, engine);
+        if (drawPermutation(edges, engine) != cornersParity) {
+            std::swap(edges[CubeState_::TOTAL_EDGES - 2], edges[CubeState_::TOTAL_EDGES - 1]);
+        }
+
+        CubeState_ state;
+        for (unsigned short i = 0; i < CubeState_::TOTAL_CORNERS; ++i) state.setCorner(i, corners[i], 0);
+        for (unsigned short i = 0; i < CubeState_::TOTAL_EDGES; ++i) state.setEdge(i, edges[i], 0);
+        unrankCornersOrientation((std::uint16_t) engine.below(NB_CORNERS_ORIENTATIONS), state);
+        unrankEdgesOrientation((std::uint16_t) engine.below(NB_EDGES_ORIENTATIONS), state);
+        return state;
+    }
+
+    CubeState_ drawRandomState() {
+        return drawRandomState(getThreadEngine());
+    }
+
+    void drawRandomStates(CubeState_* states, std::size_t nbStates, Xoshiro256& engine) {
+        for (std::size_t i = 0; i < nbStates; ++i) {
+            states[i] = drawRandomState(engine);
+        }
+    }
+
+    void drawRandomStates(CubeState_* states, std::size_t nbStates, std::uint64_t seed, WorkStealingPool& pool) {
+        const std::size_t nbChunks = (nbStates + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        pool.parallelFor(nbChunks, [states, nbStates, seed](std::size_t chunk) {
+            Xoshiro256 engine(seed + chunk);
+            const std::size_t begin = chunk * CHUNK_SIZE;
+            drawRandomStates(states + begin, std::min(CHUNK_SIZE, nbStates - begin), engine);
+        });
+    }
+
+}
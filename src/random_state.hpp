@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+
+#include "cube_state.hpp"
+#include "random.hpp"
+#include "work_stealing_pool.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @brief Draws a state uniformly among all the states reachable from a sorted cube.
+     * @details The permutations and orientations are drawn directly, without applying any move: the edges permutation
+     * is fixed to have the parity of the corners permutation, and the last orientations are deduced from the others.
+     * @param engine random engine
+     * @return random solvable state
+     */
+    CubeState_ drawRandomState(Xoshiro256& engine);
+
+    /**
+     * @brief Draws a state uniformly, from the random engine of the calling thread (seeded from std::random_device).
+     * @return random solvable state
+     */
+    CubeState_ drawRandomState();
+
+    /**
+     * @brief Fills a buffer with uniformly drawn states.
+     * @param states buffer receiving the states
+     * @param nbStates number of states to draw
+     * @param engine random engine
+     */
+    void drawRandomStates(CubeState_* states, std::size_t nbStates, Xoshiro256& engine);
+
+    /**
+     * @brief Fills a buffer with uniformly drawn states on the threads of a pool.
+     * @details The buffer is split in fixed-size chunks, each one drawn from its own engine seeded from the seed and
+     * the chunk index, so that a seed gives the same states whatever the number of threads.
+     * @param states buffer receiving the states
+     * @param nbStates number of states to draw
+     * @param seed seed of the states
+     * @param pool pool drawing the chunks
+     */
+    void drawRandomStates(CubeState_* states, std::size_t nbStates, std::uint64_t seed, WorkStealingPool& pool);
+
+}
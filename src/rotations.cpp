@@ -11,6 +11,9 @@ namespace rubiks {
             case Rotation::ANTICLOCKWISE:
                 os << "Anticlockwise";
                 break;
+            case Rotation::HALF_TURN:
+                os << "Half turn";
+                break;
         }
         return os;
     }
@@ -19,4 +22,21 @@ namespace rubiks {
         return {Rotation::CLOCKWISE, Rotation::ANTICLOCKWISE};
     }
 
+    Rotation invertRotation(const Rotation& rotation) {
+        Rotation inverse = Rotation::HALF_TURN;
+
+        switch (rotation) {
+            case Rotation::CLOCKWISE:
+                inverse = Rotation::ANTICLOCKWISE;
+                break;
+            case Rotation::ANTICLOCKWISE:
+                inverse = Rotation::CLOCKWISE;
+                break;
+            case Rotation::HALF_TURN:
+                break;
+        }
+
+        return inverse;
+    }
+
 }
\ No newline at end of file
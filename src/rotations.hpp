@@ -12,18 +12,26 @@ namespace rubiks {
      * @enum Rotation
      * @brief Type of rotation
      */
-    enum class Rotation : bool {
+    enum class Rotation : unsigned short {
         CLOCKWISE,
-        ANTICLOCKWISE
+        ANTICLOCKWISE,
+        HALF_TURN
     };
 
     /**
-     * @brief Returns all possible values of Rotation.
-     * @details Returns an array of all possible values of a Rotation.
+     * @brief Returns the quarter-turn values of Rotation.
+     * @details Returns an array of the values of a Rotation turning a face by a quarter, in either direction.
      * @return Array of Rotations
      */
     std::array<Rotation, 2> _getAllRotations();
 
+    /**
+     * @brief Returns the rotation cancelling the input rotation.
+     * @param rotation Rotation to invert
+     * @return Rotation in the opposite direction
+     */
+    Rotation invertRotation(const Rotation& rotation);
+
     /**
      * @brief Prints a Rotation value in the ostream.
      * @details Adds a string representation of the input Rotation value to the ostream object.
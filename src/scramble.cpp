@@ -0,0 +1,52 @@
+#include "color_finder.hpp"
+#include "scramble.hpp"
+
+
+namespace rubiks {
+
+    namespace {
+
+        bool isRedundant(unsigned short move, unsigned short lastMove) {
+            if (lastMove >= NB_MOVES) return false;
+            const unsigned short face = move / 3, lastFace = lastMove / 3;
+            return face == lastFace
+                   || (face < lastFace && (unsigned short) ColorFinder::getOpposite((Color) face) == lastFace);
+        }
+
+    }
+
+    ScrambleGenerator::ScrambleGenerator(std::uint64_t seed)
+            : engine_(seed) {}
+
+    void ScrambleGenerator::seed(std::uint64_t seed) {
+        engine_.seed(seed);
+    }
+
+    unsigned short ScrambleGenerator::drawMove(unsigned short lastMove) {
+        unsigned short move;
+        do {
+            move = (unsigned short) engine_.below(NB_MOVES);
+        } while (isRedundant(move, lastMove));
+        return move;
+    }
+
+    void ScrambleGenerator::generate(Move* moves, std::size_t length) {
+        unsigned short lastMove = NB_MOVES;
+        for (std::size_t i = 0; i < length; ++i) {
+            lastMove = drawMove(lastMove);
+            moves[i] = getMove(lastMove);
+        }
+    }
+
+    void ScrambleGenerator::generateBatch(Move* moves, std::size_t nbScrambles, std::size_t length) {
+        for (std::size_t i = 0; i < nbScrambles; ++i) {
+            generate(moves + i * length, length);
+        }
+    }
+
+    ScrambleGenerator& ScrambleGenerator::forThread() {
+        thread_local ScrambleGenerator generator(drawSeed());
+        return generator;
+    }
+
+}
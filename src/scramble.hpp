@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+
+#include "moves.hpp"
+#include "random.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @class ScrambleGenerator
+     * @brief Draws random sequences of moves without redundant consecutive moves
+     * @details Each move is drawn at once among the 18 face turns. A move rotating the same face as the previous one is
+     * rejected, as is a move rotating the opposite face when both orders give the same state (only one order of two
+     * opposite faces is kept). A seed gives the same scrambles on every platform. Drawing does not allocate.
+     */
+    class ScrambleGenerator {
+    public:
+        /**
+         * @brief ScrambleGenerator constructor
+         * @param seed seed of the scrambles
+         */
+        explicit ScrambleGenerator(std::uint64_t seed);
+
+        /**
+         * @brief restarts the scrambles from a seed
+         * @param seed seed of the scrambles
+         */
+        void seed(std::uint64_t seed);
+
+        /**
+         * @brief draws a move that may follow a given move
+         * @param lastMove index of the previous move, NB_MOVES if there is none
+         * @return index of the drawn move
+         */
+        unsigned short drawMove(unsigned short lastMove = NB_MOVES);
+
+        /**
+         * @brief fills a scramble
+         * @param moves buffer receiving the moves
+         * @param length number of moves of the scramble
+         */
+        void generate(Move* moves, std::size_t length);
+
+        /**
+         * @brief fills independent scrambles one after the other
+         * @param moves buffer receiving the moves, of size nbScrambles * length
+         * @param nbScrambles number of scrambles
+         * @param length number of moves of each scramble
+         */
+        void generateBatch(Move* moves, std::size_t nbScrambles, std::size_t length);
+
+        /**
+         * @brief retrieves the generator of the calling thread
+         * @details It is seeded from std::random_device when first used by the thread, unless seed() is called.
+         * @return generator of the calling thread
+         */
+        static ScrambleGenerator& forThread();
+
+    private:
+        Xoshiro256 engine_;
+    };
+
+}
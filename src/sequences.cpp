@@ -0,0 +1,112 @@
+#include <array>
+#include <iostream>
+
+#include "color_finder.hpp"
+#include "positions.hpp"
+#include "sequences.hpp"
+
+
+namespace rubiks {
+
+    namespace {
+
+        // Notation letter of each face, following the order of the FacePose values
+        const std::array<char, 6> FACE_LETTERS = {'F', 'B', 'R', 'L', 'U', 'D'};
+
+        // Number of clockwise quarter turns of each rotation, following the order of the Rotation values
+        const std::array<unsigned short, 3> QUARTER_TURNS = {1, 3, 2};
+
+        Rotation fromQuarterTurns(unsigned short quarterTurns) {
+            switch (quarterTurns % 4) {
+                case 1:
+                    return Rotation::CLOCKWISE;
+                case 3:
+                    return Rotation::ANTICLOCKWISE;
+                default:
+                    return Rotation::HALF_TURN;
+            }
+        }
+
+    }
+
+    std::vector<Move> parseMoves(const std::string& notation, const Color& frontColor, const Color& topColor) {
+        std::vector<Move> moves;
+        for (std::size_t i = 0; i < notation.size(); ++i) {
+            const char c = notation[i];
+            if (c == ' ' || c == '\t' || c == '\n') continue;
+
+            std::size_t face = 0;
+            while (face < FACE_LETTERS.size() && FACE_LETTERS[face] != c) ++face;
+            if (face == FACE_LETTERS.size()) {
+                std::cerr << "[parseMoves] WARNING: ignoring unexpected character '" << c << "' at position " << i
+                          << " of \"" << notation << "\"" << std::endl;
+                continue;
+            }
+
+            Rotation rotation = Rotation::CLOCKWISE;
+            if (i + 1 < notation.size() && notation[i + 1] == '2') {
+                rotation = Rotation::HALF_TURN;
+                ++i;
+                // A half turn is its own inverse, "2'" is accepted as well
+                if (i + 1 < notation.size() && notation[i + 1] == '\'') ++i;
+            }
+            else if (i + 1 < notation.size() && notation[i + 1] == '\'') {
+                rotation = Rotation::ANTICLOCKWISE;
+                ++i;
+            }
+            moves.push_back({ColorFinder::getFromFrontAndTop(frontColor, topColor, (FacePose) face), rotation});
+        }
+        return moves;
+    }
+
+    std::string formatMoves(const std::vector<Move>& moves, const Color& frontColor, const Color& topColor) {
+        std::array<char, 6> letters{};
+        for (unsigned short face = 0; face < FACE_LETTERS.size(); ++face) {
+            const Color color = ColorFinder::getFromFrontAndTop(frontColor, topColor, (FacePose) face);
+            if (color != Color::UNDEFINED) letters[(unsigned short) color] = FACE_LETTERS[face];
+        }
+
+        std::string notation;
+        for (const Move& move: moves) {
+            if (!notation.empty()) notation += ' ';
+            notation += letters[(unsigned short) move.faceColor];
+            if (move.rotation == Rotation::ANTICLOCKWISE) notation += '\'';
+            else if (move.rotation == Rotation::HALF_TURN) notation += '2';
+        }
+        return notation;
+    }
+
+    std::vector<Move> simplifyMoves(const std::vector<Move>& moves) {
+        std::vector<Move> simplified;
+        for (const Move& move: moves) {
+            // The move may merge with the last move, or with the one before when the last one rotates the opposite face
+            std::size_t target = simplified.size();
+            if (target && simplified[target - 1].faceColor == move.faceColor) {
+                --target;
+            }
+            else if (target >= 2 && simplified[target - 1].faceColor == ColorFinder::getOpposite(move.faceColor)
+                     && simplified[target - 2].faceColor == move.faceColor) {
+                target -= 2;
+            }
+
+            if (target == simplified.size()) {
+                simplified.push_back(move);
+                continue;
+            }
+            const unsigned short quarterTurns = QUARTER_TURNS[(unsigned short) simplified[target].rotation]
+                                                + QUARTER_TURNS[(unsigned short) move.rotation];
+            if (quarterTurns % 4) simplified[target].rotation = fromQuarterTurns(quarterTurns);
+            else simplified.erase(simplified.begin() + target);
+        }
+        return simplified;
+    }
+
+    CubeState_ compileMoves(const std::vector<Move>& moves) {
+        CubeState_ state;
+        for (const Move& move: moves) {
+            state.rotateFace(move.faceColor, move.rotation);
+        }
+        return state;
+    }
+
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "colors.hpp"
+#include "cube_state.hpp"
+#include "moves.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @brief Parses a sequence of moves written in the standard notation.
+     * @details Each move is a face letter (F, B, R, L, U or D for the front, back, right, left, top and bottom faces)
+     * optionally followed by ' for an anticlockwise rotation or by 2 for a half turn. Spaces are optional. The faces
+     * are mapped onto colors given the front and top colors of the cube. Unknown characters are reported on the error
+     * output and skipped.
+     * @param notation sequence of moves, such as "R U R' U2"
+     * @param frontColor color of the front face
+     * @param topColor color of the top face
+     * @return parsed moves
+     */
+    std::vector<Move> parseMoves(const std::string& notation, const Color& frontColor, const Color& topColor);
+
+    /**
+     * @brief Writes a sequence of moves in the standard notation, separated by spaces.
+     * @param moves sequence of moves
+     * @param frontColor color of the front face
+     * @param topColor color of the top face
+     * @return notation of the sequence, such as "R U R' U2"
+     */
+    std::string formatMoves(const std::vector<Move>& moves, const Color& frontColor, const Color& topColor);
+
+    /**
+     * @brief Shortens a sequence of moves without changing its effect.
+     * @details Consecutive rotations of a same face are merged into one move or cancelled, including when rotations of
+     * the opposite face, which commute with them, lie in between.
+     * @param moves sequence of moves
+     * @return equivalent sequence, in which no face is rotated twice in a row, even across its opposite face
+     */
+    std::vector<Move> simplifyMoves(const std::vector<Move>& moves);
+
+    /**
+     * @brief Composes a sequence of moves into a single state.
+     * @details Applying the sequence to any state is then a single call to <tt>state.multiply(compiled)</tt>,
+     * whatever the length of the sequence.
+     * @param moves sequence of moves
+     * @return state obtained by applying the sequence to a sorted cube
+     */
+    CubeState_ compileMoves(const std::vector<Move>& moves);
+
+}
@@ -0,0 +1,117 @@
+#include <cstring>
+#include <iostream>
+
+#include "serialization.hpp"
+
+
+namespace rubiks {
+
+    namespace {
+
+        const char MAGIC[8] = {'R', 'U', 'B', 'I', 'K', 'S', 'S', 'T'};
+        const unsigned char FORMAT_VERSION = 1;
+
+        /**
+         * @brief Header of a states file: the magic string, the format version and the record size, then padding
+         */
+        const std::size_t HEADER_SIZE = 16;
+
+        void writeHeader(unsigned char* header) {
+            std::memset(header, 0, HEADER_SIZE);
+            std::memcpy(header, MAGIC, sizeof(MAGIC));
+            header[sizeof(MAGIC)] = FORMAT_VERSION;
+            header[sizeof(MAGIC) + 1] = (unsigned char) STATE_RECORD_SIZE;
+        }
+
+    }
+
+    void encodeState(const CubeState_& state, unsigned char* record) {
+        for (unsigned short i = 0; i < CubeState_::TOTAL_CORNERS; ++i) {
+            record[i] = (unsigned char) (state.getCorner(i) << 3 | state.getCornerOrientation(i));
+        }
+        for (unsigned short i = 0; i < CubeState_::TOTAL_EDGES; ++i) {
+            record[CubeState_::TOTAL_CORNERS + i] =
+                    (unsigned char) (state.getEdge(i) << 1 | state.getEdgeOrientation(i));
+        }
+    }
+
+    bool decodeState(const unsigned char* record, CubeState_& state) {
+        for (unsigned short i = 0; i < CubeState_::TOTAL_CORNERS; ++i) {
+            if (record[i] >> 3 >= CubeState_::TOTAL_CORNERS || (record[i] & 0x7) >= 6) return false;
+        }
+        for (unsigned short i = 0; i < CubeState_::TOTAL_EDGES; ++i) {
+            if (record[CubeState_::TOTAL_CORNERS + i] >> 1 >= CubeState_::TOTAL_EDGES) return false;
+        }
+        for (unsigned short i = 0; i < CubeState_::TOTAL_CORNERS; ++i) {
+            state.setCorner(i, (unsigned char) (record[i] >> 3), (unsigned char) (record[i] & 0x7));
+        }
+        for (unsigned short i = 0; i < CubeState_::TOTAL_EDGES; ++i) {
+            const unsigned char edge = record[CubeState_::TOTAL_CORNERS + i];
+            state.setEdge(i, (unsigned char) (edge >> 1), (unsigned char) (edge & 0x1));
+        }
+        return true;
+    }
+
+    StateFileWriter::~StateFileWriter() {
+        close();
+    }
+
+    bool StateFileWriter::open(const std::string& path) {
+        close();
+        if (!file_.open(path)) return false;
+        buffer_.resize(BUFFER_SIZE);
+        writeHeader(buffer_.data());
+        bufferSize_ = HEADER_SIZE;
+        isOpen_ = true;
+        return true;
+    }
+
+    void StateFileWriter::write(const CubeState_& state) {
+        if (!isOpen_) return;
+        if (bufferSize_ + STATE_RECORD_SIZE > buffer_.size()) {
+            file_.write(buffer_.data(), bufferSize_);
+            bufferSize_ = 0;
+        }
+        encodeState(state, buffer_.data() + bufferSize_);
+        bufferSize_ += STATE_RECORD_SIZE;
+    }
+
+    bool StateFileWriter::close() {
+        if (!isOpen_) return false;
+        isOpen_ = false;
+        file_.write(buffer_.data(), bufferSize_);
+        bufferSize_ = 0;
+        return file_.commit();
+    }
+
+    bool StateFileReader::open(const std::string& path) {
+        close();
+        if (!file_.open(path)) {
+            std::cerr << "[StateFileReader] WARNING: cannot read " << path << std::endl;
+            return false;
+        }
+        unsigned char header[HEADER_SIZE];
+        writeHeader(header);
+        if (file_.size() < HEADER_SIZE || std::memcmp(file_.data(), header, HEADER_SIZE) != 0
+            || (file_.size() - HEADER_SIZE) % STATE_RECORD_SIZE != 0) {
+            std::cerr << "[StateFileReader] WARNING: " << path << " is not a states file of version "
+                      << (int) FORMAT_VERSION << std::endl;
+            close();
+            return false;
+        }
+        records_ = file_.data() + HEADER_SIZE;
+        size_ = (file_.size() - HEADER_SIZE) / STATE_RECORD_SIZE;
+        return true;
+    }
+
+    void StateFileReader::close() {
+        file_.close();
+        records_ = nullptr;
+        size_ = 0;
+    }
+
+    std::size_t StateFileReader::size() const {
+        return size_;
+    }
+
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "cube_state.hpp"
+#include "mapped_file.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @brief Size of an encoded state: one byte per corner, then one byte per edge
+     */
+    const std::size_t STATE_RECORD_SIZE = CubeState_::TOTAL_CORNERS + CubeState_::TOTAL_EDGES;
+
+    /**
+     * @brief Encodes a state on STATE_RECORD_SIZE bytes.
+     * @details Each corner position gives a byte <tt>corner * 8 + orientation</tt>, then each edge position gives a
+     * byte <tt>edge * 2 + orientation</tt>. The encoding does not depend on the byte order of the machine.
+     * @param state state to encode
+     * @param record buffer of at least STATE_RECORD_SIZE bytes receiving the encoding
+     */
+    void encodeState(const CubeState_& state, unsigned char* record);
+
+    /**
+     * @brief Decodes a state encoded by encodeState().
+     * @param record encoded state, of STATE_RECORD_SIZE bytes
+     * @param state state receiving the decoded blocks, left unchanged if the record is invalid
+     * @return true if the record holds a block and an orientation in range for every position, false otherwise
+     * (mirrored corners, with orientations 3 to 5, are accepted)
+     */
+    bool decodeState(const unsigned char* record, CubeState_& state);
+
+    /**
+     * @class StateFileWriter
+     * @brief Writes cube states to a file, as a small header followed by encoded states
+     * @details The states are buffered, and the file is written through a temporary file which replaces the path when
+     * the writer is closed, so that readers never see a partial file.
+     */
+    class StateFileWriter {
+    public:
+        static const std::size_t BUFFER_SIZE = 1 << 16;  /*!< number of bytes buffered before writing them */
+
+        StateFileWriter() = default;
+
+        /**
+         * @brief closes the file, if any
+         */
+        ~StateFileWriter();
+
+        StateFileWriter(const StateFileWriter&) = delete;
+        StateFileWriter& operator=(const StateFileWriter&) = delete;
+
+        /**
+         * @brief starts writing a file, closing the previous one
+         * @param path path of the file
+         * @return true if the file could be created
+         */
+        bool open(const std::string& path);
+
+        /**
+         * @brief appends a state to the opened file
+         * @param state state to write
+         */
+        void write(const CubeState_& state);
+
+        /**
+         * @brief writes the buffered states and replaces the path by the written file, printing a warning on failure
+         * @return true if the file was written
+         */
+        bool close();
+
+    private:
+        AtomicFileWriter_ file_;
+        std::vector<unsigned char> buffer_;  /*!< encoded states not written yet, allocated by open() */
+        std::size_t bufferSize_ = 0;         /*!< number of bytes of the buffer in use */
+        bool isOpen_ = false;
+    };
+
+    /**
+     * @class StateFileReader
+     * @brief Reads the cube states of a file written by StateFileWriter, through a read-only memory mapping
+     * @details The records are read in place, without copying the file nor allocating memory per state.
+     */
+    class StateFileReader {
+    public:
+        StateFileReader() = default;
+        ~StateFileReader() = default;
+
+        StateFileReader(const StateFileReader&) = delete;
+        StateFileReader& operator=(const StateFileReader&) = delete;
+
+        /**
+         * @brief maps a file and checks its header, printing a warning if it is invalid
+         * @param path path of the file
+         * @return true if the file was mapped
+         */
+        bool open(const std::string& path);
+
+        /**
+         * @brief unmaps the file, if any
+         */
+        void close();
+
+        /**
+         * @brief returns the number of states of the file
+         * @return number of states
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief returns an encoded state, in place
+         * @param index index of the state (less than size())
+         * @return STATE_RECORD_SIZE bytes of the state, valid until the file is closed
+         */
+        const unsigned char* getRecord(std::size_t index) const {
+            return records_ + index * STATE_RECORD_SIZE;
+        }
+
+        /**
+         * @brief decodes a state
+         * @param index index of the state (less than size())
+         * @param state state receiving the decoded blocks
+         * @return true if the record is valid (see decodeState())
+         */
+        bool read(std::size_t index, CubeState_& state) const {
+            return decodeState(getRecord(index), state);
+        }
+
+    private:
+        MappedFile_ file_;
+        const unsigned char* records_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+}
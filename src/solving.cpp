@@ -0,0 +1,27 @@
+#include "solving.hpp"
+
+
+namespace rubiks {
+
+    std::ostream &operator<<(std::ostream &os, const SolveStatus &status) {
+        switch (status) {
+            case SolveStatus::SOLVED:
+                os << "Solved";
+                break;
+            case SolveStatus::NOT_FOUND:
+                os << "Not found";
+                break;
+            case SolveStatus::NODE_LIMIT_REACHED:
+                os << "Node limit reached";
+                break;
+            case SolveStatus::TIME_LIMIT_REACHED:
+                os << "Time limit reached";
+                break;
+            case SolveStatus::UNSOLVABLE:
+                os << "Unsolvable";
+                break;
+        }
+        return os;
+    }
+
+}
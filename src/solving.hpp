@@ -0,0 +1,93 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "cube_state.hpp"
+#include "moves.hpp"
+#include "work_stealing_pool.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @enum SolveStatus
+     * @brief Outcome of a solver run
+     */
+    enum class SolveStatus : unsigned short {
+        SOLVED,              /*!< a solution was found */
+        NOT_FOUND,           /*!< no solution exists within the maximum length */
+        NODE_LIMIT_REACHED,  /*!< the search was stopped after expanding the maximum number of nodes */
+        TIME_LIMIT_REACHED,  /*!< the search was stopped after the time limit */
+        UNSOLVABLE           /*!< the input state cannot be reached from a sorted cube */
+    };
+
+    /**
+     * @struct SolveLimits
+     * @brief Budget granted to a solver run
+     */
+    struct SolveLimits {
+        unsigned short maxLength = 20;                /*!< maximum number of moves of a solution */
+        std::uint64_t maxNodes = 0;                   /*!< maximum number of expanded nodes, 0 for no limit */
+        std::chrono::milliseconds timeLimit{0};       /*!< maximum duration of the search, 0 for no limit */
+    };
+
+    /**
+     * @struct SolveResult
+     * @brief Result of a solver run
+     */
+    struct SolveResult {
+        SolveStatus status = SolveStatus::NOT_FOUND;  /*!< outcome of the run */
+        std::vector<Move> moves;                      /*!< moves to apply to the input state to sort it */
+        std::uint64_t nbNodes = 0;                    /*!< number of nodes expanded by the search */
+    };
+
+    /**
+     * @brief Prints a SolveStatus value in the ostream.
+     * @param os Output stream in which to print the SolveStatus value
+     * @param status Element to print
+     * @return Reference to the modified os stream
+     */
+    std::ostream &operator<<(std::ostream &os, const SolveStatus &status);
+
+    /**
+     * @brief Solves a batch of cube states on the threads of a pool
+     * @details All the workers share the tables of the solver, whose solve() method must support concurrent calls,
+     * as OptimalSolver and TwoPhaseSolver do. The limits apply to each state separately.
+     * @tparam Solver solver type, providing <tt>SolveResult solve(const CubeState_&, const SolveLimits&) const</tt>
+     * @param solver solver shared by all the workers
+     * @param states first state of the batch
+     * @param nbStates number of states of the batch
+     * @param limits budget granted to the solving of each state
+     * @param pool pool running the searches
+     * @return results of the states, in the same order as the states, each holding its own status
+     */
+    template <class Solver>
+    std::vector<SolveResult> solveBatch(const Solver& solver, const CubeState_* states, std::size_t nbStates,
+                                        const SolveLimits& limits, WorkStealingPool& pool) {
+        std::vector<SolveResult> results(nbStates);
+        pool.parallelFor(nbStates, [&solver, states, &limits, &results](std::size_t i) {
+            results[i] = solver.solve(states[i], limits);
+        });
+        return results;
+    }
+
+    /**
+     * @brief Solves a batch of cube states on a temporary pool of threads
+     * @tparam Solver solver type, providing <tt>SolveResult solve(const CubeState_&, const SolveLimits&) const</tt>
+     * @param solver solver shared by all the workers
+     * @param states states of the batch
+     * @param limits budget granted to the solving of each state
+     * @param nbThreads number of worker threads, 0 to use one per hardware thread
+     * @return results of the states, in the same order as the states, each holding its own status
+     */
+    template <class Solver>
+    std::vector<SolveResult> solveBatch(const Solver& solver, const std::vector<CubeState_>& states,
+                                        const SolveLimits& limits = SolveLimits(), unsigned int nbThreads = 0) {
+        WorkStealingPool pool(nbThreads);
+        return solveBatch(solver, states.data(), states.size(), limits, pool);
+    }
+
+}
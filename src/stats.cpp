@@ -0,0 +1,153 @@
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include "mapped_file.hpp"
+#include "stats.hpp"
+
+
+namespace rubiks {
+
+    namespace {
+
+        const unsigned short FIRST_NON_FACE_STAT = (unsigned short) Stat::GET_FACE_CALLS;
+
+        const char* const FACE_NAMES[NB_COLORS] = {"red", "green", "blue", "yellow", "orange", "white"};
+
+        /**
+         * @brief Names and descriptions of the counters following the face turns
+         */
+        const char* const STAT_NAMES[NB_STATS - FIRST_NON_FACE_STAT] = {
+                "get_face_calls", "states_hashed", "solver_nodes", "pruning_lookups", "pruning_cutoffs"};
+        const char* const STAT_HELPS[NB_STATS - FIRST_NON_FACE_STAT] = {
+                "Calls to Cube::getFace()", "States hashed from scratch", "Nodes expanded by the solvers",
+                "Distance estimates read from the pruning tables", "Distance estimates that pruned the node"};
+
+        /**
+         * @brief Counters of the running threads, and totals of the exited ones
+         */
+        struct Registry_ {
+            std::mutex mutex;
+            std::vector<const ThreadStats_*> threads;
+            StatsSnapshot exited;
+            StatsSnapshot baseline;  /*!< values subtracted by statsSnapshot(), set by resetStats() */
+        };
+
+        Registry_& getRegistry() {
+            // Never destroyed, so that threads exiting after main() can still unregister
+            static Registry_* registry = new Registry_();
+            return *registry;
+        }
+
+        /**
+         * @brief Sums the counters, the registry being locked
+         */
+        StatsSnapshot sumCounters(const Registry_& registry) {
+            StatsSnapshot snapshot = registry.exited;
+            for (const ThreadStats_* stats: registry.threads) {
+                for (unsigned short i = 0; i < NB_STATS; ++i) {
+                    snapshot.values[i] += stats->get((Stat) i);
+                }
+            }
+            return snapshot;
+        }
+
+        bool writeFile(const std::string& path, const std::string& text) {
+            AtomicFileWriter_ writer;
+            if (!writer.open(path)) return false;
+            writer.write(text.data(), text.size());
+            return writer.commit();
+        }
+
+    }
+
+    std::uint64_t StatsSnapshot::get(const Stat& stat) const {
+        return values[(std::size_t) stat];
+    }
+
+    double StatsSnapshot::getPruningCutoffRate() const {
+        const std::uint64_t lookups = get(Stat::PRUNING_LOOKUPS);
+        return lookups ? (double) get(Stat::PRUNING_CUTOFFS) / (double) lookups : 0.;
+    }
+
+    std::string StatsSnapshot::toJson() const {
+        std::ostringstream json;
+        json << "{\"enabled\": " << (STATS_ENABLED ? "true" : "false") << ", \"face_turns\": {";
+        for (unsigned short face = 0; face < NB_COLORS; ++face) {
+            json << (face ? ", \"" : "\"") << FACE_NAMES[face] << "\": " << values[face];
+        }
+        json << "}";
+        for (unsigned short i = FIRST_NON_FACE_STAT; i < NB_STATS; ++i) {
+            json << ", \"" << STAT_NAMES[i - FIRST_NON_FACE_STAT] << "\": " << values[i];
+        }
+        json << ", \"pruning_cutoff_rate\": " << getPruningCutoffRate() << "}\n";
+        return json.str();
+    }
+
+    std::string StatsSnapshot::toPrometheus() const {
+        std::ostringstream text;
+        text << "# HELP rubiks_face_turns_total Face turns applied to cube states\n"
+             << "# TYPE rubiks_face_turns_total counter\n";
+        for (unsigned short face = 0; face < NB_COLORS; ++face) {
+            text << "rubiks_face_turns_total{face=\"" << FACE_NAMES[face] << "\"} " << values[face] << "\n";
+        }
+        for (unsigned short i = FIRST_NON_FACE_STAT; i < NB_STATS; ++i) {
+            const char* name = STAT_NAMES[i - FIRST_NON_FACE_STAT];
+            text << "# HELP rubiks_" << name << "_total " << STAT_HELPS[i - FIRST_NON_FACE_STAT] << "\n"
+                 << "# TYPE rubiks_" << name << "_total counter\n"
+                 << "rubiks_" << name << "_total " << values[i] << "\n";
+        }
+        text << "# HELP rubiks_pruning_cutoff_ratio Share of the pruning table lookups that pruned the node\n"
+             << "# TYPE rubiks_pruning_cutoff_ratio gauge\n"
+             << "rubiks_pruning_cutoff_ratio " << getPruningCutoffRate() << "\n";
+        return text.str();
+    }
+
+    bool StatsSnapshot::writeJson(const std::string& path) const {
+        return writeFile(path, toJson());
+    }
+
+    bool StatsSnapshot::writePrometheus(const std::string& path) const {
+        return writeFile(path, toPrometheus());
+    }
+
+    StatsSnapshot statsSnapshot() {
+        Registry_& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        StatsSnapshot snapshot = sumCounters(registry);
+        for (unsigned short i = 0; i < NB_STATS; ++i) {
+            snapshot.values[i] -= registry.baseline.values[i];
+        }
+        return snapshot;
+    }
+
+    void resetStats() {
+        Registry_& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.baseline = sumCounters(registry);
+    }
+
+    ThreadStats_::ThreadStats_() : counters_() {
+        for (std::atomic<std::uint64_t>& counter: counters_) {
+            counter.store(0, std::memory_order_relaxed);
+        }
+        Registry_& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.threads.push_back(this);
+    }
+
+    ThreadStats_::~ThreadStats_() {
+        Registry_& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (unsigned short i = 0; i < NB_STATS; ++i) {
+            registry.exited.values[i] += get((Stat) i);
+        }
+        for (std::size_t i = 0; i < registry.threads.size(); ++i) {
+            if (registry.threads[i] != this) continue;
+            registry.threads[i] = registry.threads.back();
+            registry.threads.pop_back();
+            break;
+        }
+    }
+
+}
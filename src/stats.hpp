@@ -0,0 +1,182 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "colors.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @enum Stat
+     * @brief Operation counted by the statistics of the library
+     * @details The statistics are only counted when the library is built with the RUBIKS_STATS option; otherwise the
+     * counting calls compile to nothing and the snapshots hold zeros.
+     */
+    enum class Stat : unsigned short {
+        RED_FACE_TURNS,     /*!< face turns applied to cube states, per face in the order of Color */
+        GREEN_FACE_TURNS,
+        BLUE_FACE_TURNS,
+        YELLOW_FACE_TURNS,
+        ORANGE_FACE_TURNS,
+        WHITE_FACE_TURNS,
+        GET_FACE_CALLS,     /*!< calls to Cube::getFace() */
+        STATES_HASHED,      /*!< states hashed from scratch by getZobristHash() */
+        SOLVER_NODES,       /*!< nodes expanded by the solvers */
+        PRUNING_LOOKUPS,    /*!< distance estimates read from the pruning tables by the solvers */
+        PRUNING_CUTOFFS     /*!< distance estimates that pruned the node */
+    };
+
+    /**
+     * @brief Number of values of Stat
+     */
+    const unsigned short NB_STATS = 11;
+
+    /**
+     * @brief Whether the library counts its statistics
+     */
+#ifdef RUBIKS_STATS
+    constexpr bool STATS_ENABLED = true;
+#else
+    constexpr bool STATS_ENABLED = false;
+#endif
+
+    /**
+     * @struct StatsSnapshot
+     * @brief Statistics of all the threads, summed at a given time
+     */
+    struct StatsSnapshot {
+        std::array<std::uint64_t, NB_STATS> values{};  /*!< value of each counter, indexed by Stat */
+
+        /**
+         * @brief returns the value of a counter
+         * @param stat counter to read
+         * @return number of counted operations
+         */
+        std::uint64_t get(const Stat& stat) const;
+
+        /**
+         * @brief returns the share of the pruning table lookups that pruned the node
+         * @return PRUNING_CUTOFFS / PRUNING_LOOKUPS, 0 without lookup
+         */
+        double getPruningCutoffRate() const;
+
+        /**
+         * @brief formats the statistics as a JSON object
+         * @return JSON text, face turns being grouped by face name
+         */
+        std::string toJson() const;
+
+        /**
+         * @brief formats the statistics in the Prometheus text exposition format
+         * @return counters prefixed by "rubiks_", face turns being labelled by face name
+         */
+        std::string toPrometheus() const;
+
+        /**
+         * @brief writes the statistics as JSON to a file, replacing it atomically
+         * @param path path of the file
+         * @return true if the file was written, false otherwise
+         */
+        bool writeJson(const std::string& path) const;
+
+        /**
+         * @brief writes the statistics in the Prometheus text format to a file, replacing it atomically
+         * @details The file can be collected by the textfile collector of the Prometheus node exporter.
+         * @param path path of the file
+         * @return true if the file was written, false otherwise
+         */
+        bool writePrometheus(const std::string& path) const;
+    };
+
+    /**
+     * @brief Sums the counters of all the threads, the ones that have exited included.
+     * @details The counters of the other threads are read while they are counting, so the snapshot may miss their
+     * latest operations.
+     * @return statistics counted since the start of the program or the last call to resetStats()
+     */
+    StatsSnapshot statsSnapshot();
+
+    /**
+     * @brief Restarts the statistics from zero.
+     * @details The counters are not modified: the current values are stored and subtracted by statsSnapshot().
+     */
+    void resetStats();
+
+    /**
+     * @class ThreadStats_
+     * @brief Counters of the calling thread, registered in the global statistics for as long as the thread runs
+     * @details Each counter is only written by its thread, with a relaxed load and store instead of an atomic
+     * increment, so that counting costs a plain addition while staying readable by statsSnapshot().
+     */
+    class ThreadStats_ {
+    public:
+        ThreadStats_();
+
+        /**
+         * @brief adds the counters to the ones of the exited threads, and unregisters them
+         */
+        ~ThreadStats_();
+
+        ThreadStats_(const ThreadStats_&) = delete;
+        ThreadStats_& operator=(const ThreadStats_&) = delete;
+
+        /**
+         * @brief retrieves the counters of the calling thread, registering them on the first call
+         * @return counters of the thread
+         */
+        static ThreadStats_& forThread() {
+            thread_local ThreadStats_ stats;
+            return stats;
+        }
+
+        /**
+         * @brief increases a counter, from the thread owning the counters only
+         * @param stat counter to increase
+         * @param amount number of operations
+         */
+        void add(const Stat& stat, std::uint64_t amount) {
+            std::atomic<std::uint64_t>& counter = counters_[(std::size_t) stat];
+            counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief reads a counter, from any thread
+         * @param stat counter to read
+         * @return number of counted operations
+         */
+        std::uint64_t get(const Stat& stat) const {
+            return counters_[(std::size_t) stat].load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::array<std::atomic<std::uint64_t>, NB_STATS> counters_;
+    };
+
+    /**
+     * @brief Counts operations in the statistics of the calling thread, when they are enabled.
+     * @param stat counter to increase
+     * @param amount number of operations
+     */
+    inline void countStat(const Stat& stat, std::uint64_t amount = 1) {
+#ifdef RUBIKS_STATS
+        ThreadStats_::forThread().add(stat, amount);
+#else
+        (void) stat;
+        (void) amount;
+#endif
+    }
+
+    /**
+     * @brief Counts face turns in the statistics of the calling thread, when they are enabled.
+     * @param face rotated face
+     * @param amount number of rotated states
+     */
+    inline void countFaceTurns(const Color& face, std::uint64_t amount = 1) {
+        countStat((Stat) ((unsigned short) Stat::RED_FACE_TURNS + (unsigned short) face), amount);
+    }
+
+}
@@ -0,0 +1,177 @@
+#include <array>
+
+#include "symmetries.hpp"
+
+
+namespace rubiks {
+
+    namespace {
+
+        /**
+         * @brief Basic symmetry, as the block located at each position and its orientation
+         */
+        struct BasicSymmetry_ {
+            unsigned char cornersPermutation[CubeState_::TOTAL_CORNERS];
+            unsigned char cornersOrientation[CubeState_::TOTAL_CORNERS];
+            unsigned char edgesPermutation[CubeState_::TOTAL_EDGES];
+            unsigned char edgesOrientation[CubeState_::TOTAL_EDGES];
+        };
+
+        // Rotation by 120 degrees around the BLUE-RED-YELLOW corner axis
+        const BasicSymmetry_ CORNER_ROTATION = {
+                {0, 4, 5, 1, 3, 7, 6, 2},
+                {1, 2, 1, 2, 2, 1, 2, 1},
+                {1, 8, 5, 9, 3, 11, 7, 10, 0, 4, 6, 2},
+                {1, 0, 1, 0, 1, 0, 1, 0, 1, 1, 1, 1},
+        };
+
+        // Rotation by 180 degrees around the RED face axis
+        const BasicSymmetry_ HALF_FRONT_ROTATION = {
+                {5, 4, 7, 6, 1, 0, 3, 2},
+                {0, 0, 0, 0, 0, 0, 0, 0},
+                {6, 5, 4, 7, 2, 1, 0, 3, 9, 8, 11, 10},
+                {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        };
+
+        // Rotation by 90 degrees around the BLUE face axis
+        const BasicSymmetry_ QUARTER_TOP_ROTATION = {
+                {3, 0, 1, 2, 7, 4, 5, 6},
+                {0, 0, 0, 0, 0, 0, 0, 0},
+                {3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10},
+                {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1},
+        };
+
+        // Reflection exchanging the YELLOW and WHITE faces
+        const BasicSymmetry_ REFLECTION = {
+                {1, 0, 3, 2, 5, 4, 7, 6},
+                {3, 3, 3, 3, 3, 3, 3, 3},
+                {2, 1, 0, 3, 6, 5, 4, 7, 9, 8, 11, 10},
+                {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        };
+
+        CubeState_ makeState(const BasicSymmetry_& symmetry) {
+            CubeState_ state;
+            for (unsigned short i = 0; i < CubeState_::TOTAL_CORNERS; ++i) {
+                state.setCorner(i, symmetry.cornersPermutation[i], symmetry.cornersOrientation[i]);
+            }
+            for (unsigned short i = 0; i < CubeState_::TOTAL_EDGES; ++i) {
+                state.setEdge(i, symmetry.edgesPermutation[i], symmetry.edgesOrientation[i]);
+            }
+            return state;
+        }
+
+        struct Symmetries_ {
+            std::array<CubeState_, NB_SYMMETRIES> states;
+            std::array<unsigned short, NB_SYMMETRIES> inverses;
+        };
+
+        bool isIdentity(const CubeState_& state) {
+            for (unsigned char i = 0; i < CubeState_::TOTAL_CORNERS; ++i) {
+                if (state.getCorner(i) != i || state.getCornerOrientation(i)) return false;
+            }
+            for (unsigned char i = 0; i < CubeState_::TOTAL_EDGES; ++i) {
+                if (state.getEdge(i) != i || state.getEdgeOrientation(i)) return false;
+            }
+            return true;
+        }
+
+        Symmetries_ buildSymmetries() {
+            const CubeState_ cornerRotation = makeState(CORNER_ROTATION);
+            const CubeState_ halfFrontRotation = makeState(HALF_FRONT_ROTATION);
+            const CubeState_ quarterTopRotation = makeState(QUARTER_TOP_ROTATION);
+            const CubeState_ reflection = makeState(REFLECTION);
+
+            Symmetries_ symmetries{};
+            CubeState_ symmetry;
+            unsigned short index = 0;
+            for (unsigned short a = 0; a < 3; ++a) {
+                for (unsigned short b = 0; b < 2; ++b) {
+                    for (unsigned short c = 0; c < 4; ++c) {
+                        for (unsigned short d = 0; d < 2; ++d) {
+                            symmetries.states[index++] = symmetry;
+                            symmetry.multiply(reflection);
+                        }
+                        symmetry.multiply(quarterTopRotation);
+                    }
+                    symmetry.multiply(halfFrontRotation);
+                }
+                symmetry.multiply(cornerRotation);
+            }
+
+            for (unsigned short i = 0; i < NB_SYMMETRIES; ++i) {
+                for (unsigned short j = 0; j < NB_SYMMETRIES; ++j) {
+                    CubeState_ product(symmetries.states[i]);
+                    product.multiply(symmetries.states[j]);
+                    if (isIdentity(product)) {
+                        symmetries.inverses[i] = j;
+                        break;
+                    }
+                }
+            }
+            return symmetries;
+        }
+
+        const Symmetries_& getSymmetries() {
+            static const Symmetries_ symmetries = buildSymmetries();
+            return symmetries;
+        }
+
+        /**
+         * @brief Lexicographic order of the states, on the corners then the edges permutations and orientations
+         */
+        bool isLess(const CubeState_& first, const CubeState_& second) {
+            for (unsigned short i = 0; i < CubeState_::TOTAL_CORNERS; ++i) {
+                if (first.getCorner(i) != second.getCorner(i)) return first.getCorner(i) < second.getCorner(i);
+            }
+            for (unsigned short i = 0; i < CubeState_::TOTAL_EDGES; ++i) {
+                if (first.getEdge(i) != second.getEdge(i)) return first.getEdge(i) < second.getEdge(i);
+            }
+            for (unsigned short i = 0; i < CubeState_::TOTAL_CORNERS; ++i) {
+                if (first.getCornerOrientation(i) != second.getCornerOrientation(i)) {
+                    return first.getCornerOrientation(i) < second.getCornerOrientation(i);
+                }
+            }
+            for (unsigned short i = 0; i < CubeState_::TOTAL_EDGES; ++i) {
+                if (first.getEdgeOrientation(i) != second.getEdgeOrientation(i)) {
+                    return first.getEdgeOrientation(i) < second.getEdgeOrientation(i);
+                }
+            }
+            return false;
+        }
+
+    }
+
+    const CubeState_& getSymmetry(unsigned short index) {
+        return getSymmetries().states[index];
+    }
+
+    unsigned short getInverseSymmetry(unsigned short index) {
+        return getSymmetries().inverses[index];
+    }
+
+    CubeState_ conjugate(const CubeState_& state, unsigned short symmetry) {
+        CubeState_ result(getSymmetry(symmetry));
+        result.multiply(state);
+        result.multiply(getSymmetry(getInverseSymmetry(symmetry)));
+        return result;
+    }
+
+    CanonicalState getCanonicalState(const CubeState_& state, bool withInversion) {
+        std::array<CubeState_, NB_SYMMETRIES> conjugates;
+        CanonicalState canonical{state, 0, false};
+        conjugates[0] = state;
+        for (unsigned short symmetry = 1; symmetry < NB_SYMMETRIES; ++symmetry) {
+            conjugates[symmetry] = conjugate(state, symmetry);
+            if (isLess(conjugates[symmetry], canonical.state)) canonical = {conjugates[symmetry], symmetry, false};
+        }
+        if (withInversion) {
+            // Conjugating the inverse gives the inverse of the conjugate
+            for (unsigned short symmetry = 0; symmetry < NB_SYMMETRIES; ++symmetry) {
+                const CubeState_ inverse = conjugates[symmetry].getInverse();
+                if (isLess(inverse, canonical.state)) canonical = {inverse, symmetry, true};
+            }
+        }
+        return canonical;
+    }
+
+}
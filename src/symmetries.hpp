@@ -0,0 +1,68 @@
+#pragma once
+
+#include "cube_state.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @brief Number of symmetries of the cube: 24 rotations, each possibly combined with a reflection
+     */
+    const unsigned short NB_SYMMETRIES = 48;
+
+    /**
+     * @brief Number of symmetries keeping the axis between the BLUE and GREEN faces, which are the first ones
+     */
+    const unsigned short NB_UD_SYMMETRIES = 16;
+
+    /**
+     * @brief Returns a symmetry of the cube, as the state obtained by applying it to a sorted cube.
+     * @details Symmetry <tt>16 * a + 8 * b + 2 * c + d</tt> is the composition of a rotations by 120 degrees around the
+     * BLUE-RED-YELLOW corner axis, b rotations by 180 degrees around the RED face axis, c rotations by 90 degrees
+     * around the BLUE face axis and d reflections exchanging the YELLOW and WHITE faces. Reflected symmetries have
+     * mirrored corners (orientations 3 to 5).
+     * @param index index of the symmetry (0-47)
+     * @return state of the symmetry
+     */
+    const CubeState_& getSymmetry(unsigned short index);
+
+    /**
+     * @brief Returns the index of the symmetry cancelling a symmetry.
+     * @param index index of the symmetry (0-47)
+     * @return index of the inverse symmetry
+     */
+    unsigned short getInverseSymmetry(unsigned short index);
+
+    /**
+     * @brief Conjugates a state by a symmetry: the state seen through the symmetry.
+     * @details The result is S * state * S^-1, which is solved by the moves solving the state, transformed by S.
+     * @param state state to conjugate
+     * @param symmetry index of the symmetry S (0-47)
+     * @return conjugated state
+     */
+    CubeState_ conjugate(const CubeState_& state, unsigned short symmetry);
+
+    /**
+     * @struct CanonicalState
+     * @brief Representative of the class of a state under the symmetries, and the transform mapping the state to it
+     */
+    struct CanonicalState {
+        CubeState_ state;          /*!< representative of the class */
+        unsigned short symmetry;   /*!< index of the symmetry conjugating the (possibly inverted) state into it */
+        bool inverted;             /*!< whether the state was inverted before being conjugated */
+    };
+
+    /**
+     * @brief Returns the canonical representative of a state under the 48 symmetries, and optionally inversion.
+     * @details The representative is the smallest of the conjugates of the state (and of its inverse), comparing the
+     * corners then the edges permutations and orientations position by position. States having the same
+     * representative are solved by sequences of the same length, so that tables and caches can be keyed by the
+     * representative and be up to 48 (or 96) times smaller. The state is recovered as <tt>conjugate(canonical.state,
+     * getInverseSymmetry(canonical.symmetry))</tt>, inverted back if canonical.inverted is true.
+     * @param state state to reduce
+     * @param withInversion whether a state and its inverse belong to the same class
+     * @return representative of the state class, along with the transform mapping the state to it
+     */
+    CanonicalState getCanonicalState(const CubeState_& state, bool withInversion = true);
+
+}
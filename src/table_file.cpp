@@ -0,0 +1,143 @@
+#include <cstring>
+#include <iostream>
+
+#include "table_file.hpp"
+
+
+namespace rubiks {
+
+    namespace {
+
+        const char MAGIC[8] = {'R', 'U', 'B', 'I', 'K', 'S', 'T', 'B'};
+        const std::size_t ALIGNMENT = 64;  /*!< alignment of the tables in the file */
+
+        /**
+         * @brief Header of a table file, followed by the size of each table
+         */
+        struct Header_ {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t nbTables;
+            std::uint64_t checksum;  /*!< checksum of the bytes following the header */
+        };
+
+        std::size_t align(std::size_t offset) {
+            return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+        }
+
+        /**
+         * @brief Checksum of a buffer, FNV-1a on 8-byte words
+         */
+        std::uint64_t computeChecksum(const unsigned char* data, std::size_t size, std::uint64_t checksum) {
+            const std::uint64_t prime = 0x100000001B3ULL;
+            std::size_t i = 0;
+            for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t)) {
+                std::uint64_t word;
+                std::memcpy(&word, data + i, sizeof(word));
+                checksum = (checksum ^ word) * prime;
+            }
+            for (; i < size; ++i) {
+                checksum = (checksum ^ data[i]) * prime;
+            }
+            return checksum;
+        }
+
+        const std::uint64_t CHECKSUM_BASIS = 0xCBF29CE484222325ULL;
+
+    }
+
+    TableFile_::~TableFile_() {
+        close();
+    }
+
+    bool TableFile_::open(const std::string& path, std::uint32_t version) {
+        close();
+        if (!file_.open(path)) return false;
+        if (file_.size() < sizeof(Header_)) {
+            std::cerr << "[TableFile_] WARNING: " << path << " is truncated" << std::endl;
+            close();
+            return false;
+        }
+
+        const unsigned char* bytes = file_.data();
+        Header_ header{};
+        std::memcpy(&header, bytes, sizeof(header));
+        const std::size_t sizesEnd = sizeof(Header_) + (std::size_t) header.nbTables * sizeof(std::uint64_t);
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != version
+            || sizesEnd > file_.size()) {
+            std::cerr << "[TableFile_] WARNING: " << path << " is not a table file of version " << version << std::endl;
+            close();
+            return false;
+        }
+
+        // The checksum is computed section by section, as by write()
+        std::uint64_t checksum = computeChecksum(bytes + sizeof(Header_), sizesEnd - sizeof(Header_), CHECKSUM_BASIS);
+        std::size_t offset = sizesEnd;
+        for (std::uint32_t i = 0; i < header.nbTables; ++i) {
+            std::uint64_t size;
+            std::memcpy(&size, bytes + sizeof(Header_) + i * sizeof(std::uint64_t), sizeof(size));
+            // The size is not trusted before the checksum is verified: the check must not overflow
+            if (align(offset) > file_.size() || size > file_.size() - align(offset)) {
+                std::cerr << "[TableFile_] WARNING: " << path << " is truncated" << std::endl;
+                close();
+                return false;
+            }
+            checksum = computeChecksum(bytes + offset, align(offset) - offset, checksum);
+            offset = align(offset);
+            checksum = computeChecksum(bytes + offset, (std::size_t) size, checksum);
+            tables_.push_back({bytes + offset, (std::size_t) size});
+            offset += (std::size_t) size;
+        }
+        if (offset != file_.size() || checksum != header.checksum) {
+            std::cerr << "[TableFile_] WARNING: " << path << " is corrupted" << std::endl;
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void TableFile_::close() {
+        file_.close();
+        tables_.clear();
+    }
+
+    const std::vector<TableView_>& TableFile_::getTables() const {
+        return tables_;
+    }
+
+    bool TableFile_::write(const std::string& path, std::uint32_t version, const std::vector<TableView_>& tables) {
+        // The sizes and the tables, separated by zero padding, follow the header
+        std::vector<unsigned char> sizes(tables.size() * sizeof(std::uint64_t));
+        for (std::size_t i = 0; i < tables.size(); ++i) {
+            const auto size = (std::uint64_t) tables[i].size;
+            std::memcpy(sizes.data() + i * sizeof(std::uint64_t), &size, sizeof(size));
+        }
+        const unsigned char padding[ALIGNMENT] = {};
+        std::size_t offset = sizeof(Header_) + sizes.size();
+        std::uint64_t checksum = computeChecksum(sizes.data(), sizes.size(), CHECKSUM_BASIS);
+        std::vector<std::size_t> paddings;
+        for (const TableView_& table: tables) {
+            paddings.push_back(align(offset) - offset);
+            checksum = computeChecksum(padding, paddings.back(), checksum);
+            checksum = computeChecksum(table.data, table.size, checksum);
+            offset = align(offset) + table.size;
+        }
+        Header_ header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = version;
+        header.nbTables = (std::uint32_t) tables.size();
+        header.checksum = checksum;
+
+        // A failed write is reported by commit()
+        AtomicFileWriter_ writer;
+        if (!writer.open(path)) return false;
+        writer.write(&header, sizeof(header));
+        writer.write(sizes.data(), sizes.size());
+        for (std::size_t i = 0; i < tables.size(); ++i) {
+            writer.write(padding, paddings[i]);
+            writer.write(tables[i].data, tables[i].size);
+        }
+        return writer.commit();
+    }
+
+}
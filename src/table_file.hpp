@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "mapped_file.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @struct TableView_
+     * @brief Bytes of a table, owned elsewhere
+     */
+    struct TableView_ {
+        const unsigned char* data;
+        std::size_t size;
+    };
+
+    /**
+     * @class TableFile_
+     * @brief Read-only memory mapping of a file of precomputed tables
+     * @details A file starts with a header holding a magic string, the format version given by the writer, the number
+     * of tables and a checksum of the rest of the file, followed by the size of each table and by the tables, each one
+     * aligned on 64 bytes. Since the file is mapped read-only, every process reading it shares the same memory pages.
+     * Files are written to a temporary file first, then renamed, so that a process never maps a partial file.
+     */
+    class TableFile_ {
+    public:
+        TableFile_() = default;
+
+        /**
+         * @brief unmaps the file, invalidating its tables
+         */
+        ~TableFile_();
+
+        TableFile_(const TableFile_&) = delete;
+        TableFile_& operator=(const TableFile_&) = delete;
+
+        /**
+         * @brief maps a file and checks its header and checksum, printing a warning if it is invalid
+         * @param path path of the file
+         * @param version expected format version
+         * @return true if the file was mapped, false if it is missing or invalid
+         */
+        bool open(const std::string& path, std::uint32_t version);
+
+        /**
+         * @brief unmaps the file, if any
+         */
+        void close();
+
+        /**
+         * @brief returns the tables of the mapped file
+         * @return tables in the order they were written, valid until the file is closed
+         */
+        const std::vector<TableView_>& getTables() const;
+
+        /**
+         * @brief writes tables to a file, replacing it atomically, and prints a warning on failure
+         * @param path path of the file
+         * @param version format version
+         * @param tables tables to write
+         * @return true if the file was written
+         */
+        static bool write(const std::string& path, std::uint32_t version, const std::vector<TableView_>& tables);
+
+    private:
+        MappedFile_ file_;
+        std::vector<TableView_> tables_;
+    };
+
+}
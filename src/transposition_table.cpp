@@ -0,0 +1,41 @@
+#include <algorithm>
+#include <iostream>
+
+#include "transposition_table.hpp"
+
+
+namespace rubiks {
+
+    namespace {
+
+        const std::size_t MAX_SLOTS = (std::size_t) 1 << 32;  /*!< limit of the slot index computation */
+
+    }
+
+    TranspositionTable::TranspositionTable(std::size_t memorySize)
+            : nbSlots_(std::max<std::size_t>(1, std::min(memorySize / SLOT_SIZE, MAX_SLOTS))),
+              slots_(new Slot_[nbSlots_]) {
+        if (memorySize / SLOT_SIZE > MAX_SLOTS) {
+            std::cerr << "[TranspositionTable] WARNING: memory budget of " << memorySize << " bytes exceeds the "
+                      << MAX_SLOTS << " slots limit" << std::endl
+                      << "[TranspositionTable] Using " << nbSlots_ * SLOT_SIZE << " bytes instead" << std::endl;
+        }
+        clear();
+    }
+
+    void TranspositionTable::clear() {
+        for (std::size_t i = 0; i < nbSlots_; ++i) {
+            slots_[i].check.store(0, std::memory_order_relaxed);
+            slots_[i].data.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::size_t TranspositionTable::nbSlots() const {
+        return nbSlots_;
+    }
+
+    std::size_t TranspositionTable::memorySize() const {
+        return nbSlots_ * SLOT_SIZE;
+    }
+
+}
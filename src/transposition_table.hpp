@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+
+namespace rubiks {
+
+    /**
+     * @struct TranspositionEntry
+     * @brief Search information stored about a state
+     */
+    struct TranspositionEntry {
+        std::uint8_t depth = 0;       /*!< remaining depth the state was searched with */
+        std::uint8_t bestMove = 0xFF; /*!< index of the best move found from the state, 0xFF if none */
+        std::uint16_t bound = 0;      /*!< bound on the distance of the state, as defined by the search */
+    };
+
+    /**
+     * @class TranspositionTable
+     * @brief Fixed-size hash table of search information, shared without locks between threads
+     * @details Each slot holds the data of an entry along with the exclusive or of the data and the state hash. A
+     * reader only accepts a slot whose two words match the requested hash, so that slots torn by concurrent writes are
+     * seen as misses instead of wrong entries. A slot is replaced when its state differs or when the new entry was
+     * searched at least as deep. The memory is allocated once by the constructor.
+     */
+    class TranspositionTable {
+    public:
+        static const std::size_t SLOT_SIZE = 16;  /*!< bytes used by each entry */
+
+        /**
+         * @brief allocates an empty table
+         * @param memorySize memory budget in bytes, from a few megabytes to tens of gigabytes (up to 2^32 slots)
+         */
+        explicit TranspositionTable(std::size_t memorySize);
+
+        ~TranspositionTable() = default;
+
+        TranspositionTable(const TranspositionTable&) = delete;
+        TranspositionTable& operator=(const TranspositionTable&) = delete;
+
+        /**
+         * @brief looks an entry up
+         * @param hash 64-bit hash of the state (see getZobristHash())
+         * @param entry receives the stored entry, if any
+         * @return true if an entry of the state was found, false otherwise
+         */
+        bool probe(std::uint64_t hash, TranspositionEntry& entry) const {
+            const Slot_& slot = slots_[getSlotIndex(hash)];
+            const std::uint64_t data = slot.data.load(std::memory_order_relaxed);
+            const std::uint64_t check = slot.check.load(std::memory_order_relaxed);
+            if ((check ^ data) != hash || !data) return false;
+            entry = unpack(data);
+            return true;
+        }
+
+        /**
+         * @brief stores an entry, unless the slot holds a deeper entry of the same state
+         * @param hash 64-bit hash of the state (see getZobristHash())
+         * @param entry entry to store
+         */
+        void store(std::uint64_t hash, const TranspositionEntry& entry) {
+            Slot_& slot = slots_[getSlotIndex(hash)];
+            const std::uint64_t oldData = slot.data.load(std::memory_order_relaxed);
+            const std::uint64_t oldCheck = slot.check.load(std::memory_order_relaxed);
+            if ((oldCheck ^ oldData) == hash && oldData && unpack(oldData).depth > entry.depth) return;
+
+            const std::uint64_t data = pack(entry);
+            slot.data.store(data, std::memory_order_relaxed);
+            slot.check.store(hash ^ data, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief empties the table, it must not be used concurrently
+         */
+        void clear();
+
+        /**
+         * @brief returns the number of slots of the table
+         * @return number of slots
+         */
+        std::size_t nbSlots() const;
+
+        /**
+         * @brief returns the memory used by the slots
+         * @return size of the table in bytes
+         */
+        std::size_t memorySize() const;
+
+    private:
+        struct Slot_ {
+            std::atomic<std::uint64_t> check;  /*!< hash ^ data */
+            std::atomic<std::uint64_t> data;   /*!< packed entry, with a validity bit so that it is never 0 */
+        };
+
+        std::size_t nbSlots_;
+        std::unique_ptr<Slot_[]> slots_;
+
+        std::size_t getSlotIndex(std::uint64_t hash) const {
+            // Maps the high bits of the hash onto the slots, whatever their number
+            return (std::size_t) (((hash >> 32) * (std::uint64_t) nbSlots_) >> 32);
+        }
+
+        static std::uint64_t pack(const TranspositionEntry& entry) {
+            return (std::uint64_t) 1 << 32 | (std::uint64_t) entry.depth << 24 | (std::uint64_t) entry.bestMove << 16
+                   | entry.bound;
+        }
+
+        static TranspositionEntry unpack(std::uint64_t data) {
+            TranspositionEntry entry;
+            entry.depth = (std::uint8_t) (data >> 24);
+            entry.bestMove = (std::uint8_t) (data >> 16);
+            entry.bound = (std::uint16_t) data;
+            return entry;
+        }
+    };
+
+}
@@ -0,0 +1,475 @@
+#include <algorithm>
+#include <iostream>
+
+#include "coordinates.hpp"
+#include "stats.hpp"
+#include "symmetries.hpp"
+#include "two_phase_solver.hpp"
+#include "work_stealing_pool.hpp"
+
+
+namespace rubiks {
+
+    namespace {
+
+        const std::uint32_t NB_FLIP_SLICES = NB_SLICE_EDGES_POSITIONS * NB_EDGES_ORIENTATIONS;
+
+        std::uint32_t rankFlipSlice(const CubeState_& state) {
+            return (std::uint32_t) rankSliceEdgesPositions(state) * NB_EDGES_ORIENTATIONS + rankEdgesOrientation(state);
+        }
+
+        void unrankFlipSlice(std::uint32_t rank, CubeState_& state) {
+            unrankSliceEdgesPositions((std::uint16_t) (rank / NB_EDGES_ORIENTATIONS), state);
+            unrankEdgesOrientation((std::uint16_t) (rank % NB_EDGES_ORIENTATIONS), state);
+        }
+
+        /**
+         * @brief Gathers the values of a coordinate into classes of states conjugated by the UD symmetries
+         * @details The first coordinate of each class, in increasing order, is its representative.
+         */
+        template <class SymmetryClasses, class Rank, class Unrank>
+        void buildSymmetryClasses(SymmetryClasses& classes, std::uint32_t nbCoordinates, Rank rank, Unrank unrank) {
+            const std::uint16_t unassigned = 0xFFFF;
+            classes.classes.assign(nbCoordinates, unassigned);
+            classes.symmetries.assign(nbCoordinates, 0);
+            for (std::uint32_t coordinate = 0; coordinate < nbCoordinates; ++coordinate) {
+                if (classes.classes[coordinate] != unassigned) continue;
+
+                const auto index = (std::uint16_t) classes.representatives.size();
+                classes.representatives.push_back(coordinate);
+                classes.selfSymmetries.push_back(0);
+                CubeState_ state;
+                unrank(coordinate, state);
+                for (unsigned short symmetry = 0; symmetry < NB_UD_SYMMETRIES; ++symmetry) {
+                    const std::uint32_t conjugated = rank(conjugate(state, symmetry));
+                    if (conjugated == coordinate) classes.selfSymmetries[index] |= (std::uint16_t) (1 << symmetry);
+                    if (classes.classes[conjugated] != unassigned) continue;
+                    classes.classes[conjugated] = index;
+                    classes.symmetries[conjugated] = (unsigned char) getInverseSymmetry(symmetry);
+                }
+            }
+        }
+
+    }
+
+    /**
+     * @brief Context of a solver run
+     */
+    struct TwoPhaseSolver::Search_ {
+        const CubeState_& state;
+        const SolveLimits& limits;
+        std::chrono::steady_clock::time_point deadline;
+        std::uint64_t nbNodes;
+        bool aborted;
+        SolveStatus abortStatus;
+        bool done;                                /*!< whether a solution fitting the maximum length was found */
+        std::vector<unsigned short> phase1Path;
+        std::vector<unsigned short> phase2Path;
+        unsigned short phase2Length;
+        std::vector<unsigned short> solution;     /*!< shortest solution found so far */
+        bool hasSolution;
+    };
+
+    TwoPhaseSolver::TwoPhaseSolver(const std::string& tablesPath)
+            : cornersOrientationMoves_(NB_CORNERS_ORIENTATIONS * NB_MOVES),
+              edgesOrientationMoves_(NB_EDGES_ORIENTATIONS * NB_MOVES),
+              sliceEdgesPositionsMoves_(NB_SLICE_EDGES_POSITIONS * NB_MOVES),
+              cornersPermutationMoves_(NB_CORNERS_PERMUTATIONS * NB_PHASE2_MOVES),
+              udEdgesPermutationMoves_(NB_UD_EDGES_PERMUTATIONS * NB_PHASE2_MOVES),
+              sliceEdgesPermutationMoves_(NB_SLICE_EDGES_PERMUTATIONS * NB_PHASE2_MOVES),
+              flipSliceClasses_(),
+              cornersPermutationClasses_(),
+              cornersOrientationConjugates_(NB_CORNERS_ORIENTATIONS * NB_UD_SYMMETRIES),
+              udEdgesPermutationConjugates_(NB_UD_EDGES_PERMUTATIONS * NB_UD_SYMMETRIES),
+              phase1Table_(),
+              phase2Table_(),
+              cornersPermutationTable_(),
+              phase2Moves_(),
+              isPhase2Move_(),
+              oppositeFaces_(),
+              tablesFile_() {
+        for (unsigned short face = 0; face < CubeState_::NB_FACES; ++face) {
+            oppositeFaces_[face] = (unsigned short) ColorFinder::getOpposite((Color) face);
+        }
+
+        // The phase 2 moves keep the slice edges between the BLUE and GREEN faces, and all the blocks oriented
+        unsigned short nbPhase2Moves = 0;
+        for (unsigned short move = 0; move < NB_MOVES; ++move) {
+            const Move faceTurn = getMove(move);
+            isPhase2Move_[move] = faceTurn.faceColor == Color::BLUE || faceTurn.faceColor == Color::GREEN
+                                  || faceTurn.rotation == Rotation::HALF_TURN;
+            if (isPhase2Move_[move]) phase2Moves_[nbPhase2Moves++] = move;
+        }
+
+        // Phase 1 move tables
+        for (std::uint16_t rank = 0; rank < NB_CORNERS_ORIENTATIONS; ++rank) {
+            CubeState_ state;
+            unrankCornersOrientation(rank, state);
+            for (unsigned short move = 0; move < NB_MOVES; ++move) {
+                CubeState_ next(state);
+                next.rotateFace(getMove(move).faceColor, getMove(move).rotation);
+                cornersOrientationMoves_[rank * NB_MOVES + move] = rankCornersOrientation(next);
+            }
+        }
+        for (std::uint16_t rank = 0; rank < NB_EDGES_ORIENTATIONS; ++rank) {
+            CubeState_ state;
+            unrankEdgesOrientation(rank, state);
+            for (unsigned short move = 0; move < NB_MOVES; ++move) {
+                CubeState_ next(state);
+                next.rotateFace(getMove(move).faceColor, getMove(move).rotation);
+                edgesOrientationMoves_[rank * NB_MOVES + move] = rankEdgesOrientation(next);
+            }
+        }
+        for (std::uint16_t rank = 0; rank < NB_SLICE_EDGES_POSITIONS; ++rank) {
+            CubeState_ state;
+            unrankSliceEdgesPositions(rank, state);
+            for (unsigned short move = 0; move < NB_MOVES; ++move) {
+                CubeState_ next(state);
+                next.rotateFace(getMove(move).faceColor, getMove(move).rotation);
+                sliceEdgesPositionsMoves_[rank * NB_MOVES + move] = rankSliceEdgesPositions(next);
+            }
+        }
+
+        // Phase 2 move tables
+        for (std::uint16_t rank = 0; rank < NB_CORNERS_PERMUTATIONS; ++rank) {
+            CubeState_ state;
+            unrankCornersPermutation(rank, state);
+            for (unsigned short i = 0; i < NB_PHASE2_MOVES; ++i) {
+                CubeState_ next(state);
+                next.rotateFace(getMove(phase2Moves_[i]).faceColor, getMove(phase2Moves_[i]).rotation);
+                cornersPermutationMoves_[rank * NB_PHASE2_MOVES + i] = rankCornersPermutation(next);
+            }
+        }
+        for (std::uint16_t rank = 0; rank < NB_UD_EDGES_PERMUTATIONS; ++rank) {
+            CubeState_ state;
+            unrankUDEdgesPermutation(rank, state);
+            for (unsigned short i = 0; i < NB_PHASE2_MOVES; ++i) {
+                CubeState_ next(state);
+                next.rotateFace(getMove(phase2Moves_[i]).faceColor, getMove(phase2Moves_[i]).rotation);
+                udEdgesPermutationMoves_[rank * NB_PHASE2_MOVES + i] = rankUDEdgesPermutation(next);
+            }
+        }
+        for (std::uint16_t rank = 0; rank < NB_SLICE_EDGES_PERMUTATIONS; ++rank) {
+            CubeState_ state;
+            unrankSliceEdgesPermutation(rank, state);
+            for (unsigned short i = 0; i < NB_PHASE2_MOVES; ++i) {
+                CubeState_ next(state);
+                next.rotateFace(getMove(phase2Moves_[i]).faceColor, getMove(phase2Moves_[i]).rotation);
+                sliceEdgesPermutationMoves_[rank * NB_PHASE2_MOVES + i] = rankSliceEdgesPermutation(next);
+            }
+        }
+
+        // Symmetry classes and conjugation tables
+        buildSymmetryClasses(flipSliceClasses_, NB_FLIP_SLICES, rankFlipSlice, unrankFlipSlice);
+        buildSymmetryClasses(cornersPermutationClasses_, NB_CORNERS_PERMUTATIONS,
+                             rankCornersPermutation, [](std::uint32_t rank, CubeState_& state) {
+                    unrankCornersPermutation((std::uint16_t) rank, state);
+                });
+        for (std::uint16_t rank = 0; rank < NB_CORNERS_ORIENTATIONS; ++rank) {
+            CubeState_ state;
+            unrankCornersOrientation(rank, state);
+            for (unsigned short symmetry = 0; symmetry < NB_UD_SYMMETRIES; ++symmetry) {
+                cornersOrientationConjugates_[rank * NB_UD_SYMMETRIES + symmetry] =
+                        rankCornersOrientation(conjugate(state, symmetry));
+            }
+        }
+        for (std::uint16_t rank = 0; rank < NB_UD_EDGES_PERMUTATIONS; ++rank) {
+            CubeState_ state;
+            unrankUDEdgesPermutation(rank, state);
+            for (unsigned short symmetry = 0; symmetry < NB_UD_SYMMETRIES; ++symmetry) {
+                udEdgesPermutationConjugates_[rank * NB_UD_SYMMETRIES + symmetry] =
+                        rankUDEdgesPermutation(conjugate(state, symmetry));
+            }
+        }
+
+        // Pruning tables, mapped from the tables file when it matches the sizes of the tables
+        const std::uint64_t phase1Size =
+                (std::uint64_t) flipSliceClasses_.representatives.size() * NB_CORNERS_ORIENTATIONS;
+        const std::uint64_t phase2Size =
+                (std::uint64_t) cornersPermutationClasses_.representatives.size() * NB_UD_EDGES_PERMUTATIONS;
+        const std::uint64_t cornersPermutationSize =
+                (std::uint64_t) NB_CORNERS_PERMUTATIONS * NB_SLICE_EDGES_PERMUTATIONS;
+        if (!tablesPath.empty() && tablesFile_.open(tablesPath, TABLES_VERSION)) {
+            const std::vector<TableView_>& tables = tablesFile_.getTables();
+            if (tables.size() == 3 && tables[0].size == (phase1Size + 1) / 2 && tables[1].size == (phase2Size + 1) / 2
+                && tables[2].size == (cornersPermutationSize + 1) / 2) {
+                phase1Table_ = PruningTable_(phase1Size, tables[0].data);
+                phase2Table_ = PruningTable_(phase2Size, tables[1].data);
+                cornersPermutationTable_ = PruningTable_(cornersPermutationSize, tables[2].data);
+                return;
+            }
+            std::cerr << "[TwoPhaseSolver] WARNING: unexpected table sizes in " << tablesPath << std::endl;
+            tablesFile_.close();
+        }
+
+        // The tables are independent, so they are generated in parallel
+        phase1Table_ = PruningTable_(phase1Size);
+        phase2Table_ = PruningTable_(phase2Size);
+        cornersPermutationTable_ = PruningTable_(cornersPermutationSize);
+        WorkStealingPool pool;
+        pool.parallelFor(3, [this](std::size_t table) {
+            if (table == 0) generatePhase1Table();
+            else if (table == 1) generatePhase2Table();
+            else generateCornersPermutationTable();
+        });
+        if (!tablesPath.empty()) {
+            TableFile_::write(tablesPath, TABLES_VERSION, {
+                    {phase1Table_.data(), phase1Table_.memorySize()},
+                    {phase2Table_.data(), phase2Table_.memorySize()},
+                    {cornersPermutationTable_.data(), cornersPermutationTable_.memorySize()}});
+        }
+    }
+
+    void TwoPhaseSolver::generatePhase1Table() {
+        // Indexed by edges class * NB_CORNERS_ORIENTATIONS + corners orientation
+        CubeState_ sortedState;
+        phase1Table_.generate(
+                (std::uint64_t) flipSliceClasses_.classes[rankFlipSlice(sortedState)] * NB_CORNERS_ORIENTATIONS,
+                NB_MOVES,
+                [this](std::uint64_t index, unsigned short move) {
+                    const std::uint32_t flipSlice =
+                            flipSliceClasses_.representatives[index / NB_CORNERS_ORIENTATIONS];
+                    const auto orientation = (std::uint32_t) (index % NB_CORNERS_ORIENTATIONS);
+                    return phase1Index(
+                            sliceEdgesPositionsMoves_[flipSlice / NB_EDGES_ORIENTATIONS * NB_MOVES + move],
+                            edgesOrientationMoves_[flipSlice % NB_EDGES_ORIENTATIONS * NB_MOVES + move],
+                            cornersOrientationMoves_[orientation * NB_MOVES + move]);
+                },
+                [this](std::uint64_t index, const std::function<void(std::uint64_t)>& visit) {
+                    const auto edgesClass = (std::uint32_t) (index / NB_CORNERS_ORIENTATIONS);
+                    const auto orientation = (std::uint32_t) (index % NB_CORNERS_ORIENTATIONS);
+                    const std::uint16_t selfSymmetries = flipSliceClasses_.selfSymmetries[edgesClass];
+                    for (unsigned short symmetry = 1; symmetry < NB_UD_SYMMETRIES; ++symmetry) {
+                        if (!(selfSymmetries & (1 << symmetry))) continue;
+                        visit((std::uint64_t) edgesClass * NB_CORNERS_ORIENTATIONS
+                              + cornersOrientationConjugates_[orientation * NB_UD_SYMMETRIES + symmetry]);
+                    }
+                });
+    }
+
+    void TwoPhaseSolver::generatePhase2Table() {
+        // Indexed by corners class * NB_UD_EDGES_PERMUTATIONS + UD edges permutation
+        CubeState_ sortedState;
+        phase2Table_.generate(
+                phase2Index(rankCornersPermutation(sortedState), rankUDEdgesPermutation(sortedState)),
+                NB_PHASE2_MOVES,
+                [this](std::uint64_t index, unsigned short move) {
+                    const std::uint32_t permutation =
+                            cornersPermutationClasses_.representatives[index / NB_UD_EDGES_PERMUTATIONS];
+                    const auto udEdges = (std::uint32_t) (index % NB_UD_EDGES_PERMUTATIONS);
+                    return phase2Index(cornersPermutationMoves_[permutation * NB_PHASE2_MOVES + move],
+                                       udEdgesPermutationMoves_[udEdges * NB_PHASE2_MOVES + move]);
+                },
+                [this](std::uint64_t index, const std::function<void(std::uint64_t)>& visit) {
+                    const auto cornersClass = (std::uint32_t) (index / NB_UD_EDGES_PERMUTATIONS);
+                    const auto udEdges = (std::uint32_t) (index % NB_UD_EDGES_PERMUTATIONS);
+                    const std::uint16_t selfSymmetries = cornersPermutationClasses_.selfSymmetries[cornersClass];
+                    for (unsigned short symmetry = 1; symmetry < NB_UD_SYMMETRIES; ++symmetry) {
+                        if (!(selfSymmetries & (1 << symmetry))) continue;
+                        visit((std::uint64_t) cornersClass * NB_UD_EDGES_PERMUTATIONS
+                              + udEdgesPermutationConjugates_[udEdges * NB_UD_SYMMETRIES + symmetry]);
+                    }
+                });
+    }
+
+    void TwoPhaseSolver::generateCornersPermutationTable() {
+        // Indexed by corners permutation * NB_SLICE_EDGES_PERMUTATIONS + slice edges permutation
+        cornersPermutationTable_.generate(0, NB_PHASE2_MOVES, [this](std::uint64_t index, unsigned short move) {
+            const auto permutation = (std::uint32_t) (index / NB_SLICE_EDGES_PERMUTATIONS);
+            const auto slice = (std::uint32_t) (index % NB_SLICE_EDGES_PERMUTATIONS);
+            return (std::uint64_t) cornersPermutationMoves_[permutation * NB_PHASE2_MOVES + move]
+                   * NB_SLICE_EDGES_PERMUTATIONS + sliceEdgesPermutationMoves_[slice * NB_PHASE2_MOVES + move];
+        });
+    }
+
+    SolveResult TwoPhaseSolver::solve(const CubeState_ &state, const SolveLimits &limits) const {
+        SolveResult result;
+        if (!state.isSolvable()) {
+            result.status = SolveStatus::UNSOLVABLE;
+            return result;
+        }
+        if (state.isSorted()) {
+            result.status = SolveStatus::SOLVED;
+            return result;
+        }
+
+        Search_ search{state, limits, std::chrono::steady_clock::now() + limits.timeLimit, 0, false,
+                       SolveStatus::NOT_FOUND, false, std::vector<unsigned short>(limits.maxLength),
+                       std::vector<unsigned short>(MAX_PHASE2_LENGTH), 0, std::vector<unsigned short>(), false};
+        const Phase1Node_ root{rankCornersOrientation(state), rankEdgesOrientation(state),
+                               rankSliceEdgesPositions(state)};
+
+        for (unsigned short bound = estimatePhase1Distance(root); bound <= limits.maxLength; ++bound) {
+            // Longer first phases cannot improve the solution found
+            if (search.hasSolution && bound >= search.solution.size()) break;
+            if (searchPhase1(search, root, 0, bound, CubeState_::NB_FACES) || search.aborted) break;
+        }
+
+        for (const unsigned short move: search.solution) {
+            result.moves.push_back(getMove(move));
+        }
+        if (search.done) result.status = SolveStatus::SOLVED;
+        else if (search.aborted) result.status = search.abortStatus;
+        else result.status = SolveStatus::NOT_FOUND;
+        result.nbNodes = search.nbNodes;
+        return result;
+    }
+
+    std::size_t TwoPhaseSolver::memorySize() const {
+        return (cornersOrientationMoves_.size() + edgesOrientationMoves_.size() + sliceEdgesPositionsMoves_.size()
+                + cornersPermutationMoves_.size() + udEdgesPermutationMoves_.size()
+                + sliceEdgesPermutationMoves_.size()) * sizeof(std::uint16_t)
+               + (flipSliceClasses_.classes.size() + cornersPermutationClasses_.classes.size()
+                  + cornersOrientationConjugates_.size() + udEdgesPermutationConjugates_.size()
+                  + flipSliceClasses_.selfSymmetries.size() + cornersPermutationClasses_.selfSymmetries.size())
+                 * sizeof(std::uint16_t)
+               + flipSliceClasses_.symmetries.size() + cornersPermutationClasses_.symmetries.size()
+               + (flipSliceClasses_.representatives.size() + cornersPermutationClasses_.representatives.size())
+                 * sizeof(std::uint32_t)
+               + phase1Table_.memorySize() + phase2Table_.memorySize() + cornersPermutationTable_.memorySize();
+    }
+
+    TwoPhaseSolver::Phase1Node_ TwoPhaseSolver::applyPhase1Move(const Phase1Node_ &node, unsigned short move) const {
+        return {cornersOrientationMoves_[node.cornersOrientation * NB_MOVES + move],
+                edgesOrientationMoves_[node.edgesOrientation * NB_MOVES + move],
+                sliceEdgesPositionsMoves_[node.sliceEdgesPositions * NB_MOVES + move]};
+    }
+
+    TwoPhaseSolver::Phase2Node_ TwoPhaseSolver::applyPhase2Move(const Phase2Node_ &node,
+                                                                unsigned short phase2Move) const {
+        return {cornersPermutationMoves_[node.cornersPermutation * NB_PHASE2_MOVES + phase2Move],
+                udEdgesPermutationMoves_[node.udEdgesPermutation * NB_PHASE2_MOVES + phase2Move],
+                sliceEdgesPermutationMoves_[node.sliceEdgesPermutation * NB_PHASE2_MOVES + phase2Move]};
+    }
+
+    std::uint64_t TwoPhaseSolver::phase1Index(std::uint16_t sliceEdgesPositions, std::uint16_t edgesOrientation,
+                                              std::uint16_t cornersOrientation) const {
+        // The corners orientation is conjugated by the symmetry bringing the edges to their class representative
+        const std::uint32_t flipSlice = (std::uint32_t) sliceEdgesPositions * NB_EDGES_ORIENTATIONS + edgesOrientation;
+        return (std::uint64_t) flipSliceClasses_.classes[flipSlice] * NB_CORNERS_ORIENTATIONS
+               + cornersOrientationConjugates_[cornersOrientation * NB_UD_SYMMETRIES
+                                               + flipSliceClasses_.symmetries[flipSlice]];
+    }
+
+    std::uint64_t TwoPhaseSolver::phase2Index(std::uint16_t cornersPermutation,
+                                              std::uint16_t udEdgesPermutation) const {
+        return (std::uint64_t) cornersPermutationClasses_.classes[cornersPermutation] * NB_UD_EDGES_PERMUTATIONS
+               + udEdgesPermutationConjugates_[udEdgesPermutation * NB_UD_SYMMETRIES
+                                               + cornersPermutationClasses_.symmetries[cornersPermutation]];
+    }
+
+    unsigned char TwoPhaseSolver::estimatePhase1Distance(const Phase1Node_ &node) const {
+        return phase1Table_.get(phase1Index(node.sliceEdgesPositions, node.edgesOrientation, node.cornersOrientation));
+    }
+
+    unsigned char TwoPhaseSolver::estimatePhase2Distance(const Phase2Node_ &node) const {
+        return std::max(
+                phase2Table_.get(phase2Index(node.cornersPermutation, node.udEdgesPermutation)),
+                cornersPermutationTable_.get((std::uint64_t) node.cornersPermutation * NB_SLICE_EDGES_PERMUTATIONS
+                                             + node.sliceEdgesPermutation));
+    }
+
+    bool TwoPhaseSolver::isAborted(Search_ &search) const {
+        ++search.nbNodes;
+        countStat(Stat::SOLVER_NODES);
+        if (search.limits.maxNodes && search.nbNodes > search.limits.maxNodes) {
+            search.aborted = true;
+            search.abortStatus = SolveStatus::NODE_LIMIT_REACHED;
+        }
+        else if (search.limits.timeLimit.count() && !(search.nbNodes & 0xFFF)
+                 && std::chrono::steady_clock::now() >= search.deadline) {
+            search.aborted = true;
+            search.abortStatus = SolveStatus::TIME_LIMIT_REACHED;
+        }
+        return search.aborted;
+    }
+
+    bool TwoPhaseSolver::searchPhase1(Search_ &search, const Phase1Node_ &node, unsigned short depth,
+                                      unsigned short bound, unsigned short lastFace) const {
+        if (depth == bound) {
+            // The pruning tables ensure that the node is in the phase 2 subgroup. If the last move keeps the subgroup,
+            // the previous node was in it too and was already handed to the phase 2.
+            if (depth && isPhase2Move_[search.phase1Path[depth - 1]]) return false;
+            return solvePhase2(search, depth);
+        }
+
+        for (unsigned short move = 0; move < NB_MOVES; ++move) {
+            // Skip moves of the last rotated face, and only rotate commuting opposite faces in one order
+            const unsigned short face = move / 3;
+            if (face == lastFace || (face < lastFace && oppositeFaces_[face] == lastFace)) continue;
+            if (isAborted(search)) return false;
+
+            const Phase1Node_ next = applyPhase1Move(node, move);
+            countStat(Stat::PRUNING_LOOKUPS);
+            if (depth + 1 + estimatePhase1Distance(next) > bound) {
+                countStat(Stat::PRUNING_CUTOFFS);
+                continue;
+            }
+
+            search.phase1Path[depth] = move;
+            if (searchPhase1(search, next, (unsigned short) (depth + 1), bound, face)) return true;
+            if (search.aborted) return false;
+        }
+        return false;
+    }
+
+    bool TwoPhaseSolver::solvePhase2(Search_ &search, unsigned short phase1Length) const {
+        CubeState_ state(search.state);
+        for (unsigned short i = 0; i < phase1Length; ++i) {
+            const Move move = getMove(search.phase1Path[i]);
+            state.rotateFace(move.faceColor, move.rotation);
+        }
+        const Phase2Node_ root{rankCornersPermutation(state), rankUDEdgesPermutation(state),
+                               rankSliceEdgesPermutation(state)};
+
+        // Only solutions shorter than the best one found so far are searched
+        const unsigned short maxLength = search.hasSolution ? (unsigned short) (search.solution.size() - 1)
+                                                            : (unsigned short) (phase1Length + MAX_PHASE2_LENGTH);
+        if (phase1Length > maxLength) return false;
+        const unsigned short maxPhase2Length = std::min<unsigned short>(MAX_PHASE2_LENGTH, maxLength - phase1Length);
+        const unsigned short lastFace = phase1Length ? search.phase1Path[phase1Length - 1] / 3 : CubeState_::NB_FACES;
+
+        for (unsigned short bound = estimatePhase2Distance(root); bound <= maxPhase2Length; ++bound) {
+            search.phase2Length = 0;
+            if (bound == 0 || searchPhase2(search, root, 0, bound, lastFace)) {
+                search.solution.assign(search.phase1Path.begin(), search.phase1Path.begin() + phase1Length);
+                search.solution.insert(search.solution.end(), search.phase2Path.begin(),
+                                       search.phase2Path.begin() + search.phase2Length);
+                search.hasSolution = true;
+                search.done = search.solution.size() <= search.limits.maxLength;
+                return search.done;
+            }
+            if (search.aborted) return false;
+        }
+        return false;
+    }
+
+    bool TwoPhaseSolver::searchPhase2(Search_ &search, const Phase2Node_ &node, unsigned short depth,
+                                      unsigned short bound, unsigned short lastFace) const {
+        for (unsigned short i = 0; i < NB_PHASE2_MOVES; ++i) {
+            const unsigned short move = phase2Moves_[i];
+            const unsigned short face = move / 3;
+            if (face == lastFace || (face < lastFace && oppositeFaces_[face] == lastFace)) continue;
+            if (isAborted(search)) return false;
+
+            const Phase2Node_ next = applyPhase2Move(node, i);
+            const unsigned char distance = estimatePhase2Distance(next);
+            countStat(Stat::PRUNING_LOOKUPS);
+            if (depth + 1 + distance > bound) {
+                countStat(Stat::PRUNING_CUTOFFS);
+                continue;
+            }
+
+            search.phase2Path[depth] = move;
+            // The cube is sorted when the pruning tables are at distance 0
+            if (!distance) {
+                search.phase2Length = (unsigned short) (depth + 1);
+                return true;
+            }
+            if (searchPhase2(search, next, (unsigned short) (depth + 1), bound, face)) return true;
+            if (search.aborted) return false;
+        }
+        return false;
+    }
+
+}
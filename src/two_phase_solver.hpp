@@ -0,0 +1,143 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "cube_state.hpp"
+#include "pruning_table.hpp"
+#include "solving.hpp"
+#include "table_file.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @class TwoPhaseSolver
+     * @brief Quickly finds short (but not necessarily shortest) solutions of cube states, in number of face turns
+     * @details The solver follows Kociemba's two-phase algorithm. The first phase orients all the blocks and brings the
+     * four edges between the BLUE and GREEN faces (the slice edges) into their slice. The second phase sorts the cube
+     * using only the moves keeping that subgroup: any rotation of the BLUE and GREEN faces and half turns of the
+     * others. Both phases are iterative-deepening searches on coordinates updated through move tables and guided by
+     * pruning tables, which are built once by the constructor (about 130 MB, in a few tens of seconds, or mapped from a
+     * file written by a previous run). The largest pruning tables combine coordinates reduced by the 16 symmetries
+     * keeping the BLUE-GREEN axis, which makes them precise enough to find solutions of about 20 moves within
+     * milliseconds. solve() keeps searching for shorter solutions until one fits the requested maximum length, and can
+     * be called concurrently on the same solver.
+     */
+    class TwoPhaseSolver {
+    public:
+        static const unsigned short NB_PHASE2_MOVES = 10;    /*!< number of moves keeping the phase 2 subgroup */
+        static const unsigned short MAX_PHASE2_LENGTH = 18;  /*!< maximum length of a phase 2 solution */
+        static const std::uint32_t TABLES_VERSION = 1;       /*!< version of the tables file format and content */
+
+        /**
+         * @brief builds the move tables and the pruning tables
+         * @details The pruning tables are memory-mapped from the tables file when it is valid, so that processes share
+         * them and start within a second. Otherwise they are generated in parallel, then written to the file.
+         * @param tablesPath path of the pruning tables file, empty to always generate the tables in memory
+         */
+        explicit TwoPhaseSolver(const std::string& tablesPath = "");
+
+        ~TwoPhaseSolver() = default;
+
+        /**
+         * @brief searches a sequence of moves sorting the given state
+         * @details The search stops at the first solution not longer than limits.maxLength. When a node or time limit
+         * stops the search first, or when there is no such solution, the result holds the shortest solution found, if
+         * any, along with the corresponding status.
+         * @param state cube state to sort
+         * @param limits target solution length, maximum number of expanded nodes and duration of the search
+         * @return status of the search and the solution moves
+         */
+        SolveResult solve(const CubeState_& state, const SolveLimits& limits = SolveLimits()) const;
+
+        /**
+         * @brief returns the memory used by the move tables and the pruning tables
+         * @return size of the tables in bytes
+         */
+        std::size_t memorySize() const;
+
+    private:
+        /**
+         * @brief Coordinates of a node of the phase 1 search
+         */
+        struct Phase1Node_ {
+            std::uint16_t cornersOrientation;
+            std::uint16_t edgesOrientation;
+            std::uint16_t sliceEdgesPositions;
+        };
+
+        /**
+         * @brief Coordinates of a node of the phase 2 search
+         */
+        struct Phase2Node_ {
+            std::uint16_t cornersPermutation;
+            std::uint16_t udEdgesPermutation;
+            std::uint16_t sliceEdgesPermutation;
+        };
+
+        /**
+         * @brief Classes of a coordinate under the symmetries keeping the BLUE-GREEN axis
+         * @details Conjugating a state having a coordinate by symmetries[coordinate] gives the state having the
+         * representative coordinate of the class.
+         */
+        struct SymmetryClasses_ {
+            std::vector<std::uint16_t> classes;          /*!< class of each coordinate */
+            std::vector<unsigned char> symmetries;       /*!< symmetry mapping each coordinate to its representative */
+            std::vector<std::uint32_t> representatives;  /*!< representative coordinate of each class */
+            std::vector<std::uint16_t> selfSymmetries;   /*!< bitmask of the symmetries keeping each representative */
+        };
+
+        struct Search_;
+
+        // Phase 1 move tables, indexed by coordinate * NB_MOVES + move
+        std::vector<std::uint16_t> cornersOrientationMoves_;
+        std::vector<std::uint16_t> edgesOrientationMoves_;
+        std::vector<std::uint16_t> sliceEdgesPositionsMoves_;
+
+        // Phase 2 move tables, indexed by coordinate * NB_PHASE2_MOVES + phase 2 move
+        std::vector<std::uint16_t> cornersPermutationMoves_;
+        std::vector<std::uint16_t> udEdgesPermutationMoves_;
+        std::vector<std::uint16_t> sliceEdgesPermutationMoves_;
+
+        // Symmetry classes of the phase 1 edges coordinate (slice edges positions * NB_EDGES_ORIENTATIONS + edges
+        // orientation) and of the corners permutation, and conjugation tables of the other coordinates, indexed by
+        // coordinate * NB_UD_SYMMETRIES + symmetry
+        SymmetryClasses_ flipSliceClasses_;
+        SymmetryClasses_ cornersPermutationClasses_;
+        std::vector<std::uint16_t> cornersOrientationConjugates_;
+        std::vector<std::uint16_t> udEdgesPermutationConjugates_;
+
+        PruningTable_ phase1Table_;              /*!< phase 1 distances given the edges class and corners orientation */
+        PruningTable_ phase2Table_;              /*!< phase 2 distances given the corners class and UD edges */
+        PruningTable_ cornersPermutationTable_;  /*!< phase 2 distances given the corners and slice permutations */
+
+        std::array<unsigned short, NB_PHASE2_MOVES> phase2Moves_;         /*!< index of the phase 2 moves */
+        std::array<bool, NB_MOVES> isPhase2Move_;                         /*!< whether a move is a phase 2 move */
+        std::array<unsigned short, CubeState_::NB_FACES> oppositeFaces_;  /*!< index of the opposite of each face */
+
+        TableFile_ tablesFile_;  /*!< mapping of the pruning tables, if they were read from a file */
+
+        void generatePhase1Table();
+        void generatePhase2Table();
+        void generateCornersPermutationTable();
+
+        Phase1Node_ applyPhase1Move(const Phase1Node_& node, unsigned short move) const;
+        Phase2Node_ applyPhase2Move(const Phase2Node_& node, unsigned short phase2Move) const;
+        std::uint64_t phase1Index(std::uint16_t sliceEdgesPositions, std::uint16_t edgesOrientation,
+                                  std::uint16_t cornersOrientation) const;
+        std::uint64_t phase2Index(std::uint16_t cornersPermutation, std::uint16_t udEdgesPermutation) const;
+        unsigned char estimatePhase1Distance(const Phase1Node_& node) const;
+        unsigned char estimatePhase2Distance(const Phase2Node_& node) const;
+
+        bool isAborted(Search_& search) const;
+        bool searchPhase1(Search_& search, const Phase1Node_& node, unsigned short depth, unsigned short bound,
+                          unsigned short lastFace) const;
+        bool solvePhase2(Search_& search, unsigned short phase1Length) const;
+        bool searchPhase2(Search_& search, const Phase2Node_& node, unsigned short depth, unsigned short bound,
+                          unsigned short lastFace) const;
+    };
+
+}
@@ -33,18 +33,4 @@ namespace rubiks {
         }
     };
 
-    /**
-     * @brief Alias for an array of Corner*
-     * @tparam length size of the array
-     */
-    template<std::size_t length>
-    using CornerPtrArray_ = std::array<Corner*, length>;
-
-    /**
-     * @brief Alias for an array of Edge*
-     * @tparam length size of the array
-     */
-    template<std::size_t length>
-    using EdgePtrArray_ = std::array<Edge*, length>;
-
 }
\ No newline at end of file
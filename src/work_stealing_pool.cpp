@@ -0,0 +1,162 @@
+#include "work_stealing_pool.hpp"
+
+
+namespace rubiks {
+
+    namespace {
+
+        /**
+         * @brief Pool whose worker runs on the calling thread, nullptr outside of the workers
+         */
+        thread_local const WorkStealingPool* currentPool = nullptr;
+
+    }
+
+    WorkStealingPool::WorkStealingPool(unsigned int nbThreads)
+            : ranges_(),
+              threads_(),
+              task_(nullptr),
+              generation_(0),
+              nbActiveWorkers_(0),
+              stopping_(false),
+              exception_() {
+        if (!nbThreads) nbThreads = std::thread::hardware_concurrency();
+        if (!nbThreads) nbThreads = 1;
+
+        for (unsigned int worker = 0; worker < nbThreads; ++worker) {
+            ranges_.emplace_back(new Range_());
+        }
+        for (unsigned int worker = 0; worker < nbThreads; ++worker) {
+            threads_.emplace_back(&WorkStealingPool::work, this, worker);
+        }
+    }
+
+    WorkStealingPool::~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        loopStarted_.notify_all();
+        for (std::thread& thread: threads_) {
+            thread.join();
+        }
+    }
+
+    unsigned int WorkStealingPool::nbThreads() const {
+        return (unsigned int) threads_.size();
+    }
+
+    void WorkStealingPool::parallelFor(std::size_t nbItems, const std::function<void(std::size_t)>& task) {
+        if (!nbItems) return;
+
+        // A nested loop would wait for the outer one to release the workers, so it runs on the calling worker
+        if (currentPool == this) {
+            std::exception_ptr exception;
+            for (std::size_t item = 0; item < nbItems; ++item) {
+                try {
+                    task(item);
+                }
+                catch (...) {
+                    if (!exception) exception = std::current_exception();
+                }
+            }
+            if (exception) std::rethrow_exception(exception);
+            return;
+        }
+
+        std::lock_guard<std::mutex> loopLock(loopMutex_);
+
+        // Contiguous ranges keep neighbouring items on the same worker until it runs out of work
+        const std::size_t nbWorkers = ranges_.size();
+        for (std::size_t worker = 0; worker < nbWorkers; ++worker) {
+            std::lock_guard<std::mutex> rangeLock(ranges_[worker]->mutex);
+            ranges_[worker]->begin = nbItems * worker / nbWorkers;
+            ranges_[worker]->end = nbItems * (worker + 1) / nbWorkers;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        task_ = &task;
+        exception_ = nullptr;
+        nbActiveWorkers_ = (unsigned int) nbWorkers;
+        ++generation_;
+        loopStarted_.notify_all();
+        loopFinished_.wait(lock, [this]() { return !nbActiveWorkers_; });
+        task_ = nullptr;
+
+        if (exception_) std::rethrow_exception(exception_);
+    }
+
+    void WorkStealingPool::work(unsigned int worker) {
+        currentPool = this;
+        std::uint64_t lastGeneration = 0;
+        while (true) {
+            const std::function<void(std::size_t)>* task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                loopStarted_.wait(lock, [this, lastGeneration]() {
+                    return stopping_ || generation_ != lastGeneration;
+                });
+                if (stopping_) return;
+                lastGeneration = generation_;
+                task = task_;
+            }
+
+            std::size_t item;
+            while (takeItem(worker, item)) {
+                try {
+                    (*task)(item);
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    if (!exception_) exception_ = std::current_exception();
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!--nbActiveWorkers_) loopFinished_.notify_all();
+        }
+    }
+
+    bool WorkStealingPool::takeItem(unsigned int worker, std::size_t& item) {
+        Range_& own = *ranges_[worker];
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(own.mutex);
+                if (own.begin < own.end) {
+                    item = own.begin++;
+                    return true;
+                }
+            }
+
+            // Steal the back half of the largest range left
+            std::size_t victim = ranges_.size(), largest = 0;
+            for (std::size_t other = 0; other < ranges_.size(); ++other) {
+                if (other == worker) continue;
+                std::lock_guard<std::mutex> lock(ranges_[other]->mutex);
+                const std::size_t size = ranges_[other]->end - ranges_[other]->begin;
+                if (size > largest) {
+                    largest = size;
+                    victim = other;
+                }
+            }
+            if (victim == ranges_.size()) return false;
+
+            std::size_t begin, end;
+            {
+                std::lock_guard<std::mutex> lock(ranges_[victim]->mutex);
+                Range_& range = *ranges_[victim];
+                if (range.begin >= range.end) continue;
+                begin = range.end - (range.end - range.begin + 1) / 2;
+                end = range.end;
+                range.end = begin;
+            }
+            // The item is taken right away, the rest of the stolen range becomes the worker's own range
+            std::lock_guard<std::mutex> lock(own.mutex);
+            item = begin;
+            own.begin = begin + 1;
+            own.end = end;
+            return true;
+        }
+    }
+
+}
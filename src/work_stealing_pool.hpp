@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace rubiks {
+
+    /**
+     * @class WorkStealingPool
+     * @brief Pool of worker threads running loops of independent items
+     * @details Each call to parallelFor() splits the items into one contiguous range per worker. A worker takes its
+     * items from the front of its own range and, once it is empty, steals the back half of the largest remaining
+     * range, so that uneven item costs are balanced without a shared queue. The threads are started once by the
+     * constructor and wait for the next loop in between.
+     */
+    class WorkStealingPool {
+    public:
+        /**
+         * @brief starts the worker threads
+         * @param nbThreads number of workers, 0 to use one per hardware thread
+         */
+        explicit WorkStealingPool(unsigned int nbThreads = 0);
+
+        /**
+         * @brief waits for the running loop, if any, and stops the worker threads
+         */
+        ~WorkStealingPool();
+
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        /**
+         * @brief returns the number of worker threads
+         * @return number of workers
+         */
+        unsigned int nbThreads() const;
+
+        /**
+         * @brief calls a task on every item index, from the worker threads, and waits for all of them
+         * @details Loops submitted concurrently from several threads are run one after the other. A loop submitted by a
+         * task to its own pool is run inline by the calling worker. If tasks throw, the remaining items are still
+         * processed and the first exception is rethrown once the loop is over.
+         * @param nbItems number of items
+         * @param task callable <tt>void(std::size_t item)</tt>, called once per item in [0, nbItems)
+         */
+        void parallelFor(std::size_t nbItems, const std::function<void(std::size_t)>& task);
+
+    private:
+        /**
+         * @brief Range of items left to a worker
+         */
+        struct Range_ {
+            std::mutex mutex;
+            std::size_t begin = 0;
+            std::size_t end = 0;
+        };
+
+        std::vector<std::unique_ptr<Range_>> ranges_;
+        std::vector<std::thread> threads_;
+
+        std::mutex loopMutex_;            /*!< serializes the calls to parallelFor() */
+        std::mutex mutex_;                /*!< protects the loop state below */
+        std::condition_variable loopStarted_;
+        std::condition_variable loopFinished_;
+        const std::function<void(std::size_t)>* task_;
+        std::uint64_t generation_;        /*!< number of loops started so far */
+        unsigned int nbActiveWorkers_;    /*!< workers still running the current loop */
+        bool stopping_;
+        std::exception_ptr exception_;
+
+        void work(unsigned int worker);
+        bool takeItem(unsigned int worker, std::size_t& item);
+    };
+
+}
@@ -0,0 +1,109 @@
+#include "random.hpp"
+#include "stats.hpp"
+#include "zobrist.hpp"
+
+
+namespace rubiks {
+
+    namespace {
+
+        const std::uint64_t KEYS_SEED = 0x5DEECE66DULL;  /*!< fixed, so that hashes are stable across runs */
+
+        /**
+         * @brief Random keys of the Zobrist hash, and positions moved by the rotation of each face
+         */
+        struct ZobristKeys_ {
+            std::uint64_t corners[CubeState_::TOTAL_CORNERS][CubeState_::TOTAL_CORNERS][3];
+            std::uint64_t edges[CubeState_::TOTAL_EDGES][CubeState_::TOTAL_EDGES][2];
+            unsigned char movedCorners[CubeState_::NB_FACES][CubeState_::CORNERS_PER_FACE];
+            unsigned char movedEdges[CubeState_::NB_FACES][CubeState_::EDGES_PER_FACE];
+        };
+
+        ZobristKeys_ buildKeys() {
+            ZobristKeys_ keys{};
+            Xoshiro256 engine(KEYS_SEED);
+            for (auto& position: keys.corners) {
+                for (auto& corner: position) {
+                    for (std::uint64_t& key: corner) key = engine();
+                }
+            }
+            for (auto& position: keys.edges) {
+                for (auto& edge: position) {
+                    for (std::uint64_t& key: edge) key = engine();
+                }
+            }
+
+            // The positions whose block changes when turning a sorted cube are the positions of the face
+            for (unsigned short face = 0; face < CubeState_::NB_FACES; ++face) {
+                CubeState_ state;
+                state.rotateFace((Color) face, Rotation::CLOCKWISE);
+                unsigned short nbCorners = 0, nbEdges = 0;
+                for (unsigned char i = 0; i < CubeState_::TOTAL_CORNERS; ++i) {
+                    if (state.getCorner(i) != i) keys.movedCorners[face][nbCorners++] = i;
+                }
+                for (unsigned char i = 0; i < CubeState_::TOTAL_EDGES; ++i) {
+                    if (state.getEdge(i) != i) keys.movedEdges[face][nbEdges++] = i;
+                }
+            }
+            return keys;
+        }
+
+        const ZobristKeys_& getKeys() {
+            static const ZobristKeys_ keys = buildKeys();
+            return keys;
+        }
+
+        std::uint64_t hashFace(const ZobristKeys_& keys, const CubeState_& state, unsigned short face) {
+            std::uint64_t hash = 0;
+            for (const unsigned char position: keys.movedCorners[face]) {
+                hash ^= keys.corners[position][state.getCorner(position)][state.getCornerOrientation(position)];
+            }
+            for (const unsigned char position: keys.movedEdges[face]) {
+                hash ^= keys.edges[position][state.getEdge(position)][state.getEdgeOrientation(position)];
+            }
+            return hash;
+        }
+
+    }
+
+    std::uint64_t getZobristHash(const CubeState_& state) {
+        countStat(Stat::STATES_HASHED);
+        const ZobristKeys_& keys = getKeys();
+        std::uint64_t hash = 0;
+        for (unsigned short position = 0; position < CubeState_::TOTAL_CORNERS; ++position) {
+            hash ^= keys.corners[position][state.getCorner(position)][state.getCornerOrientation(position)];
+        }
+        for (unsigned short position = 0; position < CubeState_::TOTAL_EDGES; ++position) {
+            hash ^= keys.edges[position][state.getEdge(position)][state.getEdgeOrientation(position)];
+        }
+        return hash;
+    }
+
+    HashedCubeState::HashedCubeState()
+            : HashedCubeState(CubeState_()) {}
+
+    HashedCubeState::HashedCubeState(const CubeState_& state)
+            : state_(state),
+              hash_(getZobristHash(state)) {}
+
+    void HashedCubeState::rotateFace(const Color& color, const Rotation& rotation) {
+        if (color == Color::UNDEFINED) {
+            state_.rotateFace(color, rotation);
+            return;
+        }
+        const ZobristKeys_& keys = getKeys();
+        const auto face = (unsigned short) color;
+        hash_ ^= hashFace(keys, state_, face);
+        state_.rotateFace(color, rotation);
+        hash_ ^= hashFace(keys, state_, face);
+    }
+
+    const CubeState_& HashedCubeState::getState() const {
+        return state_;
+    }
+
+    std::uint64_t HashedCubeState::getHash() const {
+        return hash_;
+    }
+
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+
+#include "cube_state.hpp"
+
+
+namespace rubiks {
+
+    /**
+     * @brief Computes the 64-bit Zobrist hash of a state.
+     * @details The hash is the exclusive or of one fixed random key per (position, block, orientation) triple, so that
+     * a face turn can update it from the eight blocks it moves only (see HashedCubeState). The keys are drawn from a
+     * fixed seed, so that hashes are stable across runs.
+     * @param state cube state, whose orientations must be in their usual ranges (no mirrored corner)
+     * @return hash of the state
+     */
+    std::uint64_t getZobristHash(const CubeState_& state);
+
+    /**
+     * @class HashedCubeState
+     * @brief Cube state along with its Zobrist hash, updated incrementally by each face turn
+     */
+    class HashedCubeState {
+    public:
+        /**
+         * @brief builds a sorted state
+         */
+        HashedCubeState();
+
+        /**
+         * @brief builds a copy of a state, hashing it
+         * @param state cube state
+         */
+        explicit HashedCubeState(const CubeState_& state);
+
+        /**
+         * @brief rotates given cube face in a given direction, updating the hash from the moved blocks only
+         * @param color color of the face to rotate (designates the color of the middle block)
+         * @param rotation rotation direction
+         */
+        void rotateFace(const Color& color, const Rotation& rotation);
+
+        /**
+         * @brief retrieves the cube state
+         * @return state of the cube
+         */
+        const CubeState_& getState() const;
+
+        /**
+         * @brief retrieves the hash of the cube state
+         * @return hash equal to getZobristHash(getState())
+         */
+        std::uint64_t getHash() const;
+
+    private:
+        CubeState_ state_;
+        std::uint64_t hash_;
+    };
+
+}